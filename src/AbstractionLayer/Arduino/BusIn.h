@@ -0,0 +1,104 @@
+#ifndef BUS_IN_H
+#define BUS_IN_H
+
+#include "Common/NonCopyable.h"
+#include "PinMode.h"
+#include "BusPins.h"
+
+/**
+ * @brief Up to 16 Digital Inputs read as one value (mbed compatible). The pins are grouped by
+ * their port, a read is one register read per port instead of a digitalRead() per pin, so the pins
+ * of a port are sampled at the same time. On boards without a port map (e.g. Teensy), the pins
+ * are read one after another.
+ * 
+ */
+class BusIn : private NonCopyable<BusIn> {
+    public:
+        /**
+         * @brief Construct a new Bus In object
+         * 
+         * @param pin The Pin of bit 0
+         * @param pins The Pins of the following bits
+         */
+        template<typename... Pins>
+        explicit BusIn(PinName pin, Pins... pins) {
+            static_assert(sizeof...(Pins) < steroido_intern::BusPins::MaxPins, "A BusIn has at most 16 pins");
+
+            const PinName list[] = {pin, static_cast<PinName>(pins)...};
+            _attach(list, 1 + sizeof...(Pins));
+        }
+
+        /**
+         * @brief Construct a new Bus In object
+         * 
+         * @param pins The Pins, bit 0 first
+         * @param count Count of Pins, at most 16
+         */
+        BusIn(const PinName *pins, uint8_t count) {
+            _attach(pins, count);
+        }
+
+        /**
+         * @brief Read the Inputs, the first pin is bit 0
+         * 
+         * @return int 
+         */
+        int read() {
+            return _pins.read(false);
+        }
+
+        /**
+         * @brief Set the Pinmode of all pins, standard is OpenDrain
+         * 
+         * @param _pinMode PullUp or OpenDrain
+         */
+        void mode(PinMode _pinMode) {
+            for (uint8_t i = 0; i < _pins.count(); i++) {
+                pinMode(_pinNames[i], _pinMode == PullUp ? INPUT_PULLUP : INPUT);
+            }
+        }
+
+        /**
+         * @brief Returns a mask of the bits used by the bus
+         * 
+         * @return int 
+         */
+        int mask() {
+            return (1L << _pins.count()) - 1;
+        }
+
+        /**
+         * @brief Check whether the bus has a pin at this index
+         * 
+         * @param index 
+         * @return true if there is a pin
+         */
+        bool is_pin_connected(int index) {
+            return index >= 0 && index < _pins.count();
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return int 
+         */
+        operator int() {
+            return read();
+        }
+
+    private:
+        steroido_intern::BusPins _pins;
+        PinName _pinNames[steroido_intern::BusPins::MaxPins];
+
+        void _attach(const PinName *pins, uint8_t count) {
+            if (count > steroido_intern::BusPins::MaxPins) count = steroido_intern::BusPins::MaxPins;
+
+            for (uint8_t i = 0; i < count; i++) {
+                _pinNames[i] = pins[i];
+                _pins.add(pins[i]);
+            }
+            mode(OpenDrain);
+        }
+};
+
+#endif // BUS_IN_H
@@ -0,0 +1,112 @@
+#ifndef BUS_OUT_H
+#define BUS_OUT_H
+
+#include "Common/NonCopyable.h"
+#include "BusPins.h"
+
+/**
+ * @brief Up to 16 Digital Outputs written as one value (mbed compatible). The pins are grouped by
+ * their port, a write is one masked register write per port instead of a digitalWrite() per pin,
+ * so the pins of a port change at the same time. On boards without a port map (e.g. Teensy), the
+ * pins are written one after another.
+ * 
+ */
+class BusOut : private NonCopyable<BusOut> {
+    public:
+        /**
+         * @brief Construct a new Bus Out object
+         * 
+         * @param pin The Pin of bit 0
+         * @param pins The Pins of the following bits
+         */
+        template<typename... Pins>
+        explicit BusOut(PinName pin, Pins... pins) {
+            static_assert(sizeof...(Pins) < steroido_intern::BusPins::MaxPins, "A BusOut has at most 16 pins");
+
+            const PinName list[] = {pin, static_cast<PinName>(pins)...};
+            _attach(list, 1 + sizeof...(Pins));
+        }
+
+        /**
+         * @brief Construct a new Bus Out object
+         * 
+         * @param pins The Pins, bit 0 first
+         * @param count Count of Pins, at most 16
+         */
+        BusOut(const PinName *pins, uint8_t count) {
+            _attach(pins, count);
+        }
+
+        /**
+         * @brief Write to the Outputs, bit 0 to the first pin
+         * 
+         * @param value 
+         */
+        void write(int value) {
+            _pins.write(value);
+        }
+
+        /**
+         * @brief Read the set Value
+         * 
+         * @return int 
+         */
+        int read() {
+            return _pins.read(true);
+        }
+
+        /**
+         * @brief Returns a mask of the bits used by the bus
+         * 
+         * @return int 
+         */
+        int mask() {
+            return (1L << _pins.count()) - 1;
+        }
+
+        /**
+         * @brief Check whether the bus has a pin at this index
+         * 
+         * @param index 
+         * @return true if there is a pin
+         */
+        bool is_pin_connected(int index) {
+            return index >= 0 && index < _pins.count();
+        }
+
+        /**
+         * @brief Shorthand for write(value)
+         * 
+         * @param value 
+         * @return BusOut& 
+         */
+        BusOut &operator=(int value) {
+            write(value);
+            return *this;
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return int 
+         */
+        operator int() {
+            return read();
+        }
+
+    private:
+        steroido_intern::BusPins _pins;
+
+        void _attach(const PinName *pins, uint8_t count) {
+            if (count > steroido_intern::BusPins::MaxPins) count = steroido_intern::BusPins::MaxPins;
+
+            for (uint8_t i = 0; i < count; i++) {
+                pinMode(pins[i], OUTPUT);
+                // Through digitalWrite(), so it also disconnects a PWM timer from the pin
+                digitalWrite(pins[i], LOW);
+                _pins.add(pins[i]);
+            }
+        }
+};
+
+#endif // BUS_OUT_H
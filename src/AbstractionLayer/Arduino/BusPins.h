@@ -0,0 +1,131 @@
+#ifndef BUS_PINS_H
+#define BUS_PINS_H
+
+#include <stdint.h>
+#include "GpioPort.h"
+
+namespace steroido_intern {
+    /**
+     * @brief The pins of a BusOut/BusIn, grouped by their port. A bus value is written with one
+     * masked write per port and read with one read per port.
+     *
+     */
+    class BusPins {
+        public:
+            static constexpr uint8_t MaxPins = 16;
+
+            /**
+             * @brief Add the next pin of the bus (bit 0 first)
+             *
+             * @param pin
+             */
+            void add(PinName pin) {
+                uint8_t bit = _count++;
+                GpioPort port = GpioPort::ofPin(pin);
+                uint8_t portBit = _bitNumber(GpioPort::maskOf(pin));
+
+                uint8_t group = 0;
+                while (group < _groupCount && !(_groups[group].port == port)) group++;
+                if (group == _groupCount) {
+                    _groupCount++;
+                    _groups[group].port = port;
+                    _groups[group].offset = portBit - bit;
+                } else if (_groups[group].offset != portBit - bit) {
+                    _groups[group].offset = _scattered;
+                }
+
+                _groups[group].mask |= 1 << portBit;
+                _pins[bit] = (group << 4) | portBit;
+            }
+
+            /**
+             * @brief Write the bus value, one masked write per port
+             *
+             * @param value
+             */
+            void write(uint16_t value) {
+                for (uint8_t group = 0; group < _groupCount; group++) {
+                    _groups[group].port.write(_groups[group].mask, _toPort(group, value));
+                }
+            }
+
+            /**
+             * @brief Read the bus value, one read per port
+             *
+             * @param output true to read the level the pins are driven to
+             * @return uint16_t
+             */
+            uint16_t read(bool output) const {
+                uint16_t value = 0;
+                for (uint8_t group = 0; group < _groupCount; group++) {
+                    const GpioPort &port = _groups[group].port;
+                    value |= _fromPort(group, output ? port.readOutput() : port.read());
+                }
+                return value;
+            }
+
+            /**
+             * @brief Returns the count of pins
+             *
+             * @return uint8_t
+             */
+            uint8_t count() const {
+                return _count;
+            }
+
+        private:
+            // Offset of a port whose pins are not in the same order as on the bus
+            static constexpr int8_t _scattered = -128;
+
+            struct Group {
+                GpioPort port;
+                uint8_t mask = 0;
+                // Port bit minus bus bit, the same for all pins of the group, or _scattered
+                int8_t offset = 0;
+            };
+
+            Group _groups[MaxPins];
+            // Group in the upper, bit in the port in the lower 4 bits
+            uint8_t _pins[MaxPins];
+            uint8_t _count = 0;
+            uint8_t _groupCount = 0;
+
+            static uint8_t _bitNumber(uint8_t mask) {
+                uint8_t bit = 0;
+                while (mask > 1) {
+                    mask >>= 1;
+                    bit++;
+                }
+                return bit;
+            }
+
+            uint8_t _toPort(uint8_t group, uint16_t value) const {
+                const Group &g = _groups[group];
+                if (g.offset != _scattered) {
+                    return (g.offset >= 0 ? value << g.offset : value >> -g.offset) & g.mask;
+                }
+
+                uint8_t portValue = 0;
+                for (uint8_t bit = 0; bit < _count; bit++) {
+                    if ((_pins[bit] >> 4) == group && (value & (1 << bit))) portValue |= 1 << (_pins[bit] & 0x0F);
+                }
+                return portValue;
+            }
+
+            uint16_t _fromPort(uint8_t group, uint8_t portValue) const {
+                const Group &g = _groups[group];
+                portValue &= g.mask;
+                if (g.offset != _scattered) {
+                    return g.offset >= 0 ? portValue >> g.offset : (uint16_t)portValue << -g.offset;
+                }
+
+                uint16_t value = 0;
+                for (uint8_t bit = 0; bit < _count; bit++) {
+                    if ((_pins[bit] >> 4) == group && (portValue & (1 << (_pins[bit] & 0x0F)))) value |= 1 << bit;
+                }
+                return value;
+            }
+    };
+};
+
+#endif // BUS_PINS_H
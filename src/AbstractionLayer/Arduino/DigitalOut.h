@@ -1,8 +1,11 @@
 #ifndef DIGITAL_OUT_H
 #define DIGITAL_OUT_H
 
+#include "PinRegister.h"
+
 /**
- * @brief Digital Output
+ * @brief Digital Output. On AVR and Teensy, the pin registers are resolved once in the constructor
+ * and written directly. Define STEROIDO_CACHED_OUTPUTS to skip writes not changing the output.
  * 
  */
 class DigitalOut {
@@ -15,6 +18,12 @@ class DigitalOut {
         DigitalOut(PinName pin)
         : _pin(pin) {
             pinMode(pin, OUTPUT);
+#ifdef STEROIDO_DIRECT_PINS
+            _register.attach(pin);
+            _value = _register.read();
+            // Once through digitalWrite(), it also disconnects a PWM timer from the pin
+            digitalWrite(pin, _value ? HIGH : LOW);
+#endif
         }
 
         /**
@@ -34,13 +43,30 @@ class DigitalOut {
          * @param value 1 for HIGH, 0 for LOW
          */
         void write(uint8_t value) {
-            if (value >= 1) {
-                digitalWrite(_pin, HIGH);
-                _value = 1;
-            } else {
-                digitalWrite(_pin, LOW);
-                _value = 0;
-            }
+            value = value >= 1 ? 1 : 0;
+#ifdef STEROIDO_CACHED_OUTPUTS
+            if (value == _value) return;
+#endif
+
+#ifdef STEROIDO_DIRECT_PINS
+            _register.write(value);
+#else
+            digitalWrite(_pin, value ? HIGH : LOW);
+#endif
+            _value = value;
+        }
+
+        /**
+         * @brief Invert the Output
+         * 
+         */
+        void toggle() {
+#ifdef STEROIDO_DIRECT_PINS
+            _register.toggle();
+            _value ^= 1;
+#else
+            write(!read());
+#endif
         }
 
         /**
@@ -49,7 +75,7 @@ class DigitalOut {
          * @return uint8_t The last set Value, 1 for HIGH, 0 for LOW
          */
         uint8_t read() {
-            return _value;
+            return _value == 1 ? 1 : 0;
         }
 
         /**
@@ -73,8 +99,14 @@ class DigitalOut {
         }
     
     private:
+        // Not written yet, the level is unknown
+        static constexpr uint8_t _unknown = 2;
+
         PinName _pin;
-        uint8_t _value = 0;
+        uint8_t _value = _unknown;
+#ifdef STEROIDO_DIRECT_PINS
+        steroido_intern::PinRegister _register;
+#endif
 };
 
 #endif // DIGITAL_OUT_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef FAST_DIGITAL_IN_H
+#define FAST_DIGITAL_IN_H
+
+#include "Common/NonCopyable.h"
+#include "PinMode.h"
+#include "FastPin.h"
+
+/**
+ * @brief Digital Input with the pin known at compile time. Same as DigitalIn, but port and mask
+ * are resolved by the compiler: a read is a single instruction on AVR and the object takes no RAM.
+ * 
+ * @tparam Pin The Pin this FastDigitalIn is assigned to
+ */
+template<PinName Pin>
+class FastDigitalIn : private NonCopyable<FastDigitalIn<Pin>> {
+    typedef steroido_intern::FastPin<Pin> _Pin;
+
+    public:
+        /**
+         * @brief Construct a new Fast Digital In object
+         * 
+         * @param _pinMode The Pinmode, standard is OpenDrain
+         */
+        FastDigitalIn(PinMode _pinMode = OpenDrain) {
+            switch (_pinMode) {
+                case PullUp:
+                    pinMode(Pin, INPUT_PULLUP);
+                    break;
+            
+                default:
+                    pinMode(Pin, INPUT);
+                    break;
+            }
+        }
+
+        /**
+         * @brief Read the digital Input
+         * 
+         * @return uint8_t 1 if HIGH, 0 if LOW
+         */
+        uint8_t read() {
+            return _Pin::read();
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return uint8_t 1 if HIGH, 0 if LOW
+         */
+        operator uint8_t() {
+            return read();
+        }
+};
+
+#endif // FAST_DIGITAL_IN_H
@@ -0,0 +1,89 @@
+#ifndef FAST_DIGITAL_OUT_H
+#define FAST_DIGITAL_OUT_H
+
+#include "FastPin.h"
+
+/**
+ * @brief Digital Output with the pin known at compile time. Same as DigitalOut, but port and mask
+ * are resolved by the compiler: a write, toggle or read is a single instruction on AVR and the
+ * object takes no RAM.
+ * 
+ * @tparam Pin The Pin this FastDigitalOut is assigned to
+ */
+template<PinName Pin>
+class FastDigitalOut {
+    typedef steroido_intern::FastPin<Pin> _Pin;
+
+    public:
+        /**
+         * @brief Construct a new Fast Digital Out object
+         * 
+         */
+        FastDigitalOut() {
+            pinMode(Pin, OUTPUT);
+            // Once through digitalWrite(), it also disconnects a PWM timer from the pin
+            digitalWrite(Pin, _Pin::readOutput() ? HIGH : LOW);
+        }
+
+        /**
+         * @brief Construct a new Fast Digital Out object
+         * 
+         * @param value The initial Value of the Digital Output
+         */
+        FastDigitalOut(uint8_t value)
+        : FastDigitalOut() {
+            write(value);
+        }
+
+        /**
+         * @brief Write to the Output. Everything greater than 1 is HIGH, everything below is LOW
+         * 
+         * @param value 1 for HIGH, 0 for LOW
+         */
+        void write(uint8_t value) {
+            if (value >= 1) {
+                _Pin::set();
+            } else {
+                _Pin::clear();
+            }
+        }
+
+        /**
+         * @brief Invert the Output
+         * 
+         */
+        void toggle() {
+            _Pin::toggle();
+        }
+
+        /**
+         * @brief Read the set Value
+         * 
+         * @return uint8_t The set Value, 1 for HIGH, 0 for LOW
+         */
+        uint8_t read() {
+            return _Pin::readOutput();
+        }
+
+        /**
+         * @brief Shorthand for write(value)
+         * 
+         * @param value 1 for HIGH, 0 for LOW
+         * @return FastDigitalOut& 
+         */
+        FastDigitalOut &operator=(uint8_t value) {
+            write(value);
+            return *this;
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return uint8_t 1 for HIGH, 0 for LOW
+         */
+        operator uint8_t() {
+            return read();
+        }
+};
+
+#endif // FAST_DIGITAL_OUT_H
@@ -0,0 +1,59 @@
+#ifndef FAST_PIN_H
+#define FAST_PIN_H
+
+#include "PinMap.h"
+
+/*
+    steroido_intern::FastPin<Pin> accesses a pin with the port and mask known at compile time:
+    static set(), clear(), toggle(), read() and readOutput(). Defined for
+        - ATmega48/88/168/328: single sbi/cbi/out/sbic instructions
+        - Teensy: digitalWriteFast()/digitalReadFast()
+        - NATIVE: the simulated ports of AbstractionLayer/Native/SimulatedGpio.h
+*/
+
+#if defined(NATIVE)
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+#elif defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__) || defined(__AVR_ATmega168P__) || defined(__AVR_ATmega88__) || defined(__AVR_ATmega88P__) || defined(__AVR_ATmega48__) || defined(__AVR_ATmega48P__)
+    namespace steroido_intern {
+        /**
+         * @brief The registers of an AVR port, with the data space address of PINx (DDRx and
+         * PORTx follow it). With constant single bit masks, the accesses compile to sbi/cbi.
+         *
+         */
+        template<uint8_t Address>
+        struct AvrPort {
+            static volatile uint8_t &input() { return *reinterpret_cast<volatile uint8_t*>(Address); }
+            static volatile uint8_t &output() { return *reinterpret_cast<volatile uint8_t*>(Address + 2); }
+
+            static uint8_t read() { return input(); }
+            static uint8_t readOutput() { return output(); }
+            static void set(uint8_t mask) { output() |= mask; }
+            static void clear(uint8_t mask) { output() &= ~mask; }
+            // Writing a 1 to PINx toggles the output
+            static void toggle(uint8_t mask) { input() = mask; }
+        };
+
+        template<PinName Pin>
+        struct FastPin : PortPin<Atmega328PinMap<Pin, AvrPort<0x23>, AvrPort<0x26>, AvrPort<0x29>>> {};
+    };
+#elif defined(TEENSY)
+    namespace steroido_intern {
+        template<PinName Pin>
+        struct FastPin {
+            static void set() { digitalWriteFast(Pin, HIGH); }
+            static void clear() { digitalWriteFast(Pin, LOW); }
+            static void toggle() { digitalToggleFast(Pin); }
+            static uint8_t read() { return digitalReadFast(Pin) ? 1 : 0; }
+            static uint8_t readOutput() { return read(); }
+        };
+    };
+#else
+    namespace steroido_intern {
+        template<PinName Pin>
+        struct FastPin {
+            static_assert(Pin != Pin, "There is no compile-time pin map for this board, use DigitalOut/DigitalIn");
+        };
+    };
+#endif
+
+#endif // FAST_PIN_H
@@ -0,0 +1,149 @@
+#ifndef GPIO_PORT_H
+#define GPIO_PORT_H
+
+#include <stdint.h>
+#include "PinName.h"
+#include "PortName.h"
+
+/*
+    steroido_intern::GpioPort accesses a whole GPIO port at runtime, for BusOut/BusIn and
+    PortOut/PortIn:
+
+        static GpioPort ofPin(PinName pin)      the port of a pin
+        static uint8_t maskOf(PinName pin)      the bit of a pin in its port
+        uint8_t read()                          level of the pins
+        uint8_t readOutput()                    level the pins are driven to
+        void write(uint8_t mask, uint8_t value) drive the pins of the mask, all at once
+        bool operator==(const GpioPort &other)  same port
+
+    Where whole ports are supported, STEROIDO_GPIO_PORTS is defined and there are also
+
+        GpioPort(PortName port)
+        void setOutput(uint8_t mask)
+        void setInput(uint8_t mask, bool pullUp)
+
+    Defined for AVR, for NATIVE (the simulated ports of AbstractionLayer/Native/SimulatedGpio.h)
+    and for every other board with one "port" per pin, going through digitalWrite()/digitalRead().
+*/
+
+#if defined(NATIVE)
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+#elif defined(__AVR__)
+    #define STEROIDO_GPIO_PORTS
+
+    namespace steroido_intern {
+        /**
+         * @brief An AVR port. Only the address of PORTx is stored, PINx and DDRx are right before it.
+         *
+         */
+        class GpioPort {
+            public:
+                GpioPort() : _output(&_unconnected()) {}
+
+                /**
+                 * @brief Construct a new Gpio Port
+                 *
+                 * @param port Must exist on the microcontroller
+                 */
+                explicit GpioPort(PortName port) : _output(portOutputRegister(port)) {
+                    if (!_output) _output = &_unconnected();
+                }
+
+                static GpioPort ofPin(PinName pin) {
+                    uint8_t port = digitalPinToPort(pin);
+                    return port == NOT_A_PIN ? GpioPort() : GpioPort((PortName)port);
+                }
+
+                static uint8_t maskOf(PinName pin) {
+                    return digitalPinToBitMask(pin);
+                }
+
+                bool operator==(const GpioPort &other) const {
+                    return _output == other._output;
+                }
+
+                uint8_t read() const {
+                    return *(_output - 2);
+                }
+
+                uint8_t readOutput() const {
+                    return *_output;
+                }
+
+                void write(uint8_t mask, uint8_t value) {
+                    // Read-modify-write, an interrupt must not change the port in between
+                    uint8_t oldSREG = SREG;
+                    cli();
+                    *_output = (*_output & ~mask) | (value & mask);
+                    SREG = oldSREG;
+                }
+
+                void setOutput(uint8_t mask) {
+                    uint8_t oldSREG = SREG;
+                    cli();
+                    *(_output - 1) |= mask;
+                    SREG = oldSREG;
+                }
+
+                void setInput(uint8_t mask, bool pullUp) {
+                    uint8_t oldSREG = SREG;
+                    cli();
+                    *(_output - 1) &= ~mask;
+                    if (pullUp) *_output |= mask;
+                    else *_output &= ~mask;
+                    SREG = oldSREG;
+                }
+
+            private:
+                volatile uint8_t *_output;
+
+                // Registers of an unknown port, so nothing else is written
+                static volatile uint8_t &_unconnected() {
+                    static volatile uint8_t registers[3];
+                    return registers[2];
+                }
+        };
+    };
+#else
+    namespace steroido_intern {
+        /**
+         * @brief A single pin as "port", for boards without a port map
+         *
+         */
+        class GpioPort {
+            public:
+                GpioPort() : _pin(0xFF) {}
+
+                static GpioPort ofPin(PinName pin) {
+                    GpioPort port;
+                    port._pin = pin;
+                    return port;
+                }
+
+                static uint8_t maskOf(PinName) {
+                    return 1;
+                }
+
+                bool operator==(const GpioPort &other) const {
+                    return _pin == other._pin;
+                }
+
+                uint8_t read() const {
+                    return digitalRead(_pin) == HIGH ? 1 : 0;
+                }
+
+                uint8_t readOutput() const {
+                    return read();
+                }
+
+                void write(uint8_t mask, uint8_t value) {
+                    if (mask & 1) digitalWrite(_pin, (value & 1) ? HIGH : LOW);
+                }
+
+            private:
+                PinName _pin;
+        };
+    };
+#endif
+
+#endif // GPIO_PORT_H
@@ -0,0 +1,57 @@
+#ifndef PIN_MAP_H
+#define PIN_MAP_H
+
+#include <stdint.h>
+#include "Common/TypeTraits.h"
+#include "PinName.h"
+
+/*
+    Compile-time pin maps for FastDigitalOut/FastDigitalIn. A port type provides static functions
+    for its registers:
+
+        uint8_t read()              level of the pins
+        uint8_t readOutput()        level the pins are driven to
+        void set(uint8_t mask)      drive the pins of the mask HIGH
+        void clear(uint8_t mask)    drive the pins of the mask LOW
+        void toggle(uint8_t mask)   invert the pins of the mask
+*/
+
+namespace steroido_intern {
+    /**
+     * @brief A single pin of a port, everything resolved at compile time
+     *
+     * @tparam Map Pin map with the type Port and the constant mask
+     */
+    template<class Map>
+    struct PortPin {
+        typedef typename Map::Port Port;
+        static constexpr uint8_t mask = Map::mask;
+
+        static void set() { Port::set(mask); }
+        static void clear() { Port::clear(mask); }
+        static void toggle() { Port::toggle(mask); }
+        static uint8_t read() { return (Port::read() & mask) ? 1 : 0; }
+        static uint8_t readOutput() { return (Port::readOutput() & mask) ? 1 : 0; }
+    };
+
+    template<class Map>
+    constexpr uint8_t PortPin<Map>::mask;
+
+    /**
+     * @brief Pin numbers of the ATmega48/88/168/328 Arduinos (Uno, Nano, Pro Mini): 0 to 7 are
+     * PORTD, 8 to 13 PORTB and 14 to 19 (A0 to A5) PORTC
+     *
+     */
+    template<PinName Pin, class PortB, class PortC, class PortD>
+    struct Atmega328PinMap {
+        static_assert(Pin < 20, "The ATmega328 only has the pins 0 to 19 (A0 to A5 are 14 to 19)");
+
+        typedef typename Conditional<(Pin < 8), PortD, typename Conditional<(Pin < 14), PortB, PortC>::type>::type Port;
+        static constexpr uint8_t mask = 1 << (Pin < 8 ? Pin : Pin < 14 ? Pin - 8 : Pin - 14);
+    };
+
+    template<PinName Pin, class PortB, class PortC, class PortD>
+    constexpr uint8_t Atmega328PinMap<Pin, PortB, PortC, PortD>::mask;
+};
+
+#endif // PIN_MAP_H
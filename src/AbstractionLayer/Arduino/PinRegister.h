@@ -0,0 +1,96 @@
+#ifndef PIN_REGISTER_H
+#define PIN_REGISTER_H
+
+/*
+    Direct access to the GPIO registers of a pin, resolved once instead of on every digitalWrite().
+    Used by DigitalOut on AVR and Teensy, define STEROIDO_DISABLE_DIRECT_PINS to always go through
+    digitalWrite() instead. For NATIVE, define STEROIDO_DIRECT_PINS to use the simulated registers
+    of AbstractionLayer/Native/SimulatedGpio.h.
+*/
+#if !defined(STEROIDO_DISABLE_DIRECT_PINS) && (defined(__AVR__) || defined(TEENSY))
+    #define STEROIDO_DIRECT_PINS
+#endif
+
+#if defined(STEROIDO_DIRECT_PINS) && defined(NATIVE)
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+#elif defined(STEROIDO_DIRECT_PINS)
+
+namespace steroido_intern {
+    /**
+     * @brief The output registers of a pin
+     *
+     */
+    class PinRegister {
+        public:
+            /**
+             * @brief Look up the registers of the pin, it has to be an output already
+             *
+             * @param pin
+             */
+            void attach(PinName pin) {
+                _output = portOutputRegister(digitalPinToPort(pin));
+                _mask = digitalPinToBitMask(pin);
+#ifdef __AVR__
+                _input = portInputRegister(digitalPinToPort(pin));
+#else
+                _set = portSetRegister(pin);
+                _clear = portClearRegister(pin);
+                _toggle = portToggleRegister(pin);
+#endif
+            }
+
+            /**
+             * @brief Returns the level the pin is driven to
+             *
+             * @return uint8_t 1 for HIGH, 0 for LOW
+             */
+            uint8_t read() const {
+                return (*_output & _mask) ? 1 : 0;
+            }
+
+#ifdef __AVR__
+            void write(uint8_t value) {
+                // Read-modify-write, an interrupt must not change the port in between
+                uint8_t oldSREG = SREG;
+                cli();
+                if (value) *_output |= _mask;
+                else *_output &= ~_mask;
+                SREG = oldSREG;
+            }
+
+            void toggle() {
+    #ifdef __AVR_ATmega8__
+                write(!read());
+    #else
+                // Writing a 1 to the input register toggles the output
+                *_input = _mask;
+    #endif
+            }
+#else
+            void write(uint8_t value) {
+                *(value ? _set : _clear) = _mask;
+            }
+
+            void toggle() {
+                *_toggle = _mask;
+            }
+#endif
+
+        private:
+#ifdef __AVR__
+            volatile uint8_t *_output;
+            volatile uint8_t *_input;
+            uint8_t _mask;
+#else
+            decltype(portOutputRegister(0)) _output;
+            decltype(portSetRegister(0)) _set;
+            decltype(portClearRegister(0)) _clear;
+            decltype(portToggleRegister(0)) _toggle;
+            uint32_t _mask;
+#endif
+    };
+};
+
+#endif // STEROIDO_DIRECT_PINS
+
+#endif // PIN_REGISTER_H
@@ -0,0 +1,62 @@
+#ifndef PORT_IN_H
+#define PORT_IN_H
+
+#include "Common/NonCopyable.h"
+#include "PinMode.h"
+#include "GpioPort.h"
+
+#ifdef STEROIDO_GPIO_PORTS
+
+/**
+ * @brief The pins of a whole GPIO port as Input (mbed compatible). A read is a single register
+ * read, all pins are sampled at the same time.
+ * 
+ */
+class PortIn : private NonCopyable<PortIn> {
+    public:
+        /**
+         * @brief Construct a new Port In object
+         * 
+         * @param port The Port, must exist on the microcontroller
+         * @param mask The pins of the port used as input
+         */
+        PortIn(PortName port, int mask = 0xFF)
+        : _port(port), _mask(mask) {
+            mode(OpenDrain);
+        }
+
+        /**
+         * @brief Read the Inputs, the pins not in the mask are 0
+         * 
+         * @return int 
+         */
+        int read() {
+            return _port.read() & _mask;
+        }
+
+        /**
+         * @brief Set the Pinmode of the pins
+         * 
+         * @param _pinMode PullUp or OpenDrain
+         */
+        void mode(PinMode _pinMode) {
+            _port.setInput(_mask, _pinMode == PullUp);
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return int 
+         */
+        operator int() {
+            return read();
+        }
+
+    private:
+        steroido_intern::GpioPort _port;
+        uint8_t _mask;
+};
+
+#endif // STEROIDO_GPIO_PORTS
+
+#endif // PORT_IN_H
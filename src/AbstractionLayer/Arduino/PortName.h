@@ -0,0 +1,24 @@
+#ifndef PORTNAME_H
+#define PORTNAME_H
+
+#include <stdint.h>
+
+/**
+ * @brief The GPIO ports, numbered like the ports of the Arduino AVR core (PA = 1, PB = 2 ...)
+ * 
+ */
+enum PortName : uint8_t {
+    PortA = 1,
+    PortB,
+    PortC,
+    PortD,
+    PortE,
+    PortF,
+    PortG,
+    PortH,
+    PortJ = 10,
+    PortK,
+    PortL
+};
+
+#endif // PORTNAME_H
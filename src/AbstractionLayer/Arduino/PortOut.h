@@ -0,0 +1,72 @@
+#ifndef PORT_OUT_H
+#define PORT_OUT_H
+
+#include "Common/NonCopyable.h"
+#include "GpioPort.h"
+
+#ifdef STEROIDO_GPIO_PORTS
+
+/**
+ * @brief The pins of a whole GPIO port as Output (mbed compatible). A write is a single masked
+ * register write, all pins change at the same time.
+ * 
+ */
+class PortOut : private NonCopyable<PortOut> {
+    public:
+        /**
+         * @brief Construct a new Port Out object
+         * 
+         * @param port The Port, must exist on the microcontroller
+         * @param mask The pins of the port used as output
+         */
+        PortOut(PortName port, int mask = 0xFF)
+        : _port(port), _mask(mask) {
+            _port.setOutput(_mask);
+        }
+
+        /**
+         * @brief Write to the Outputs, only the pins of the mask are changed
+         * 
+         * @param value 
+         */
+        void write(int value) {
+            _port.write(_mask, value);
+        }
+
+        /**
+         * @brief Read the set Value
+         * 
+         * @return int 
+         */
+        int read() {
+            return _port.readOutput() & _mask;
+        }
+
+        /**
+         * @brief Shorthand for write(value)
+         * 
+         * @param value 
+         * @return PortOut& 
+         */
+        PortOut &operator=(int value) {
+            write(value);
+            return *this;
+        }
+
+        /**
+         * @brief Shorthand for read()
+         * 
+         * @return int 
+         */
+        operator int() {
+            return read();
+        }
+
+    private:
+        steroido_intern::GpioPort _port;
+        uint8_t _mask;
+};
+
+#endif // STEROIDO_GPIO_PORTS
+
+#endif // PORT_OUT_H
@@ -23,6 +23,15 @@ class PwmOut : private NonCopyable<PwmOut> {
          * @param value PWM High Time from 0 to 65535
          */
         void write_u16(uint16_t value) {
+#ifdef STEROIDO_CACHED_OUTPUTS
+            // Only the upper 8 bit reach analogWrite
+            if (_written && (value >> 8) == (_value >> 8)) {
+                _value = value;
+                return;
+            }
+            _written = true;
+#endif
+
             analogWrite(_pin, (uint8_t)((uint16_t)value >> 8));
             _value = value;
         }
@@ -71,6 +80,9 @@ class PwmOut : private NonCopyable<PwmOut> {
     private:
         PinName _pin;
         uint16_t _value = 0;
+#ifdef STEROIDO_CACHED_OUTPUTS
+        bool _written = false;
+#endif
 };
 
 #endif // ANALOG_OUT_H
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef SERIAL_BYTE_SINK_H
+#define SERIAL_BYTE_SINK_H
+
+#include "Communication/IByteSink.h"
+
+/**
+ * @brief Writes to a Serial without blocking, only as many bytes as fit into its transmit buffer
+ *
+ * @tparam SerialType Type of the Serial (e.g. decltype(Serial)), must have availableForWrite()
+ */
+template<class SerialType>
+class SerialByteSink : public IByteSink {
+    public:
+        SerialByteSink(SerialType &serial) : _serial(serial) {}
+
+        size_t write(const uint8_t *data, size_t length) override {
+            int available = _serial.availableForWrite();
+            if (available <= 0) return 0;
+
+            if (length > (size_t)available) length = available;
+            return _serial.write(data, length);
+        }
+
+    private:
+        SerialType &_serial;
+};
+
+#endif // SERIAL_BYTE_SINK_H
@@ -3,8 +3,28 @@
 
 #include "Libraries/printf/printf.h"
 
-void _putchar(char character) {
-    Serial.write(character);
-}
+#ifdef STEROIDO_BUFFERED_PRINTF
+    // printf only writes into a buffer, add printfOutput to the Scheduler to send it to the Serial
+    #include "Communication/BufferedOutput.h"
+    #include "SerialByteSink.h"
 
-#endif // PRINTF_INTEGRATION_H
\ No newline at end of file
+    #ifndef STEROIDO_PRINTF_BUFFER_SIZE
+        #define STEROIDO_PRINTF_BUFFER_SIZE 256
+    #endif
+
+    SerialByteSink<decltype(Serial)> printfSink(Serial);
+    BufferedOutput<STEROIDO_PRINTF_BUFFER_SIZE> printfOutput(printfSink);
+
+    void _putchar(char character) {
+        printfOutput.write(character);
+    }
+
+    #undef printf
+    #define printf printfOutput.print
+#else
+    void _putchar(char character) {
+        Serial.write(character);
+    }
+#endif
+
+#endif // PRINTF_INTEGRATION_H
@@ -0,0 +1,26 @@
+#ifndef FILE_BYTE_SINK_H
+#define FILE_BYTE_SINK_H
+
+#include <stdio.h>
+#include "Communication/IByteSink.h"
+
+/**
+ * @brief Writes to a file or pipe (e.g. stdout or a fopen()ed FIFO), to record or forward the
+ * output when running natively
+ *
+ */
+class FileByteSink : public IByteSink {
+    public:
+        FileByteSink(FILE *file) : _file(file) {}
+
+        size_t write(const uint8_t *data, size_t length) override {
+            size_t written = fwrite(data, 1, length, _file);
+            fflush(_file);
+            return written;
+        }
+
+    private:
+        FILE *_file;
+};
+
+#endif // FILE_BYTE_SINK_H
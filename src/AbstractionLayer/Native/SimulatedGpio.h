@@ -0,0 +1,324 @@
+#ifndef SIMULATED_GPIO_H
+#define SIMULATED_GPIO_H
+
+#include <stdint.h>
+#include "AbstractionLayer/Arduino/PinMap.h"
+#include "AbstractionLayer/Arduino/PortName.h"
+
+/*
+    Simulated GPIO of an ATmega328 Arduino (ports B, C and D), to run pin code natively. Provides
+    pinMode()/digitalWrite()/digitalRead()/analogWrite() working like the Arduino AVR core, with the
+    same pin table lookups, and the simulated ports for FastPin and GpioPort. Every register access and table lookup is
+    counted in simulatedGpio().accesses to compare the cost of both ways. A read-modify-write of
+    single bits counts once, as it is a single sbi/cbi instruction on the AVR.
+
+    Define STEROIDO_DIRECT_PINS before including to simulate the PinRegister of DigitalOut as well.
+*/
+
+// Whole ports are simulated, for PortOut/PortIn
+#define STEROIDO_GPIO_PORTS
+
+#ifndef HIGH
+    #define HIGH 0x1
+    #define LOW 0x0
+#endif
+
+#ifndef INPUT
+    #define INPUT 0x0
+    #define OUTPUT 0x1
+    #define INPUT_PULLUP 0x2
+#endif
+
+/**
+ * @brief Registers of a simulated 8 bit port, like PINx, DDRx and PORTx of an AVR
+ *
+ */
+struct SimulatedPortState {
+    uint8_t direction = 0;  // 1 for output
+    uint8_t output = 0;     // driven level of outputs, pull-up of inputs
+    uint8_t driven = 0;     // inputs driven from outside (see drive())
+    uint8_t external = 0;   // level of the inputs driven from outside
+
+    /**
+     * @brief Level of the pins: outputs read their output, undriven inputs their pull-up
+     *
+     * @return uint8_t
+     */
+    uint8_t pins() const {
+        uint8_t inputs = ~direction;
+        return (output & direction) | (external & driven & inputs) | (output & ~driven & inputs);
+    }
+};
+
+/**
+ * @brief The simulated ports and the access counter
+ *
+ */
+class SimulatedGpio {
+    public:
+        enum : uint8_t {
+            PortB = 0,
+            PortC,
+            PortD,
+            PortCount
+        };
+
+        /**
+         * @brief Drive an input pin from outside (like a button)
+         *
+         * @param pin
+         * @param level 1 for HIGH, 0 for LOW
+         */
+        void drive(uint8_t pin, uint8_t level) {
+            SimulatedPortState &port = ports[portOf(pin)];
+            port.driven |= maskOf(pin);
+            if (level) port.external |= maskOf(pin);
+            else port.external &= ~maskOf(pin);
+        }
+
+        /**
+         * @brief Stop driving an input pin from outside
+         *
+         * @param pin
+         */
+        void release(uint8_t pin) {
+            ports[portOf(pin)].driven &= ~maskOf(pin);
+        }
+
+        /**
+         * @brief Returns the level of a pin, without counting an access
+         *
+         * @param pin
+         * @return uint8_t 1 for HIGH, 0 for LOW
+         */
+        uint8_t level(uint8_t pin) const {
+            return (ports[portOf(pin)].pins() & maskOf(pin)) ? 1 : 0;
+        }
+
+        /**
+         * @brief Returns the registers of a port, the ones of an unconnected port if it does not exist
+         *
+         * @param port PortB, PortC or PortD
+         * @return SimulatedPortState&
+         */
+        SimulatedPortState &port(PortName port) {
+            return port >= ::PortB && port <= ::PortD ? ports[port - ::PortB] : unconnected;
+        }
+
+        /**
+         * @brief Reset all ports and the access counter
+         *
+         */
+        void reset() {
+            for (SimulatedPortState &port : ports) port = SimulatedPortState();
+            unconnected = SimulatedPortState();
+            for (uint8_t &value : analogValues) value = 0;
+            accesses = 0;
+        }
+
+        static uint8_t portOf(uint8_t pin) {
+            return pin < 8 ? PortD : pin < 14 ? PortB : PortC;
+        }
+
+        static uint8_t maskOf(uint8_t pin) {
+            return 1 << (pin < 8 ? pin : pin < 14 ? pin - 8 : pin - 14);
+        }
+
+        SimulatedPortState ports[PortCount];
+        SimulatedPortState unconnected;
+        uint8_t analogValues[20] = {}; // last analogWrite() per pin
+        uint32_t accesses = 0;
+};
+
+/**
+ * @brief The simulated GPIO shared by all translation units. Constructed on first use.
+ *
+ * @return SimulatedGpio&
+ */
+inline SimulatedGpio& simulatedGpio() {
+    static SimulatedGpio gpio;
+    return gpio;
+}
+
+namespace steroido_intern {
+    /**
+     * @brief Port type for the pin maps, accessing a simulated port
+     *
+     * @tparam Index SimulatedGpio::PortB, PortC or PortD
+     */
+    template<uint8_t Index>
+    struct SimulatedPort {
+        static SimulatedPortState &state() { return simulatedGpio().ports[Index]; }
+
+        static uint8_t read() { simulatedGpio().accesses++; return state().pins(); }
+        static uint8_t readOutput() { simulatedGpio().accesses++; return state().output; }
+        static void set(uint8_t mask) { simulatedGpio().accesses++; state().output |= mask; }
+        static void clear(uint8_t mask) { simulatedGpio().accesses++; state().output &= ~mask; }
+        static void toggle(uint8_t mask) { simulatedGpio().accesses++; state().output ^= mask; }
+    };
+
+    template<PinName Pin>
+    struct FastPin : PortPin<Atmega328PinMap<Pin, SimulatedPort<SimulatedGpio::PortB>, SimulatedPort<SimulatedGpio::PortC>, SimulatedPort<SimulatedGpio::PortD>>> {};
+
+    // The lookups of the Arduino AVR core (digitalPinToTimer, digitalPinToBitMask, digitalPinToPort,
+    // portOutputRegister/portInputRegister/portModeRegister), each counted as an access
+    inline uint8_t simulatedLookup(uint8_t value) {
+        simulatedGpio().accesses++;
+        return value;
+    }
+
+    inline bool simulatedPinExists(uint8_t pin) {
+        simulatedLookup(0); // digitalPinToTimer
+        simulatedLookup(0); // digitalPinToBitMask
+        return simulatedLookup(pin < 20); // digitalPinToPort
+    }
+
+    // SREG is saved, interrupts blocked and SREG restored around the read-modify-write
+    inline void simulatedAtomic() {
+        simulatedGpio().accesses += 2;
+    }
+
+    /**
+     * @brief GpioPort accessing a simulated port, with the costs of the AVR implementation
+     *
+     */
+    class GpioPort {
+        public:
+            GpioPort() : _state(&simulatedGpio().unconnected) {}
+
+            explicit GpioPort(PortName port) : _state(&simulatedGpio().port(port)) {}
+
+            static GpioPort ofPin(PinName pin) {
+                return pin < 20 ? GpioPort((PortName)(::PortB + SimulatedGpio::portOf(pin))) : GpioPort();
+            }
+
+            static uint8_t maskOf(PinName pin) {
+                return pin < 20 ? SimulatedGpio::maskOf(pin) : 0;
+            }
+
+            bool operator==(const GpioPort &other) const {
+                return _state == other._state;
+            }
+
+            uint8_t read() const {
+                simulatedGpio().accesses++;
+                return _state->pins();
+            }
+
+            uint8_t readOutput() const {
+                simulatedGpio().accesses++;
+                return _state->output;
+            }
+
+            void write(uint8_t mask, uint8_t value) {
+                simulatedAtomic();
+                simulatedGpio().accesses += 2;
+                _state->output = (_state->output & ~mask) | (value & mask);
+            }
+
+            void setOutput(uint8_t mask) {
+                simulatedAtomic();
+                simulatedGpio().accesses += 2;
+                _state->direction |= mask;
+            }
+
+            void setInput(uint8_t mask, bool pullUp) {
+                simulatedAtomic();
+                simulatedGpio().accesses += 4;
+                _state->direction &= ~mask;
+                if (pullUp) _state->output |= mask;
+                else _state->output &= ~mask;
+            }
+
+        private:
+            SimulatedPortState *_state;
+    };
+
+#ifdef STEROIDO_DIRECT_PINS
+    /**
+     * @brief PinRegister accessing a simulated port, with the costs of the AVR implementation
+     *
+     */
+    class PinRegister {
+        public:
+            void attach(PinName pin) {
+                _state = &simulatedGpio().ports[simulatedLookup(SimulatedGpio::portOf(pin))];
+                _mask = simulatedLookup(SimulatedGpio::maskOf(pin));
+                simulatedLookup(0); // portInputRegister
+            }
+
+            uint8_t read() const {
+                simulatedGpio().accesses++;
+                return (_state->output & _mask) ? 1 : 0;
+            }
+
+            void write(uint8_t value) {
+                simulatedAtomic();
+                simulatedGpio().accesses += 2;
+                if (value) _state->output |= _mask;
+                else _state->output &= ~_mask;
+            }
+
+            void toggle() {
+                // Writing the mask to PINx
+                simulatedGpio().accesses++;
+                _state->output ^= _mask;
+            }
+
+        private:
+            SimulatedPortState *_state;
+            uint8_t _mask;
+    };
+#endif
+};
+
+inline void pinMode(uint8_t pin, uint8_t mode) {
+    if (!steroido_intern::simulatedPinExists(pin)) return;
+
+    SimulatedPortState &port = simulatedGpio().ports[steroido_intern::simulatedLookup(SimulatedGpio::portOf(pin))];
+    uint8_t mask = SimulatedGpio::maskOf(pin);
+    steroido_intern::simulatedAtomic();
+    simulatedGpio().accesses += 2;
+    if (mode == OUTPUT) {
+        port.direction |= mask;
+    } else {
+        port.direction &= ~mask;
+        simulatedGpio().accesses += 2;
+        if (mode == INPUT_PULLUP) port.output |= mask;
+        else port.output &= ~mask;
+    }
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+    if (!steroido_intern::simulatedPinExists(pin)) return;
+
+    SimulatedPortState &port = simulatedGpio().ports[steroido_intern::simulatedLookup(SimulatedGpio::portOf(pin))];
+    uint8_t mask = SimulatedGpio::maskOf(pin);
+    steroido_intern::simulatedAtomic();
+    simulatedGpio().accesses += 2;
+    if (value == LOW) port.output &= ~mask;
+    else port.output |= mask;
+}
+
+// Like the AVR core: the pin becomes an output, 0 and 255 are plain digitalWrite(), the rest
+// connects the timer (TCCRx) and sets the compare value (OCRx)
+inline void analogWrite(uint8_t pin, int value) {
+    pinMode(pin, OUTPUT);
+    if (value <= 0 || value >= 255) {
+        digitalWrite(pin, value <= 0 ? LOW : HIGH);
+    } else {
+        steroido_intern::simulatedLookup(0); // digitalPinToTimer
+        simulatedGpio().accesses += 2;
+    }
+    if (pin < 20) simulatedGpio().analogValues[pin] = value <= 0 ? 0 : value >= 255 ? 255 : value;
+}
+
+inline int digitalRead(uint8_t pin) {
+    if (!steroido_intern::simulatedPinExists(pin)) return LOW;
+
+    SimulatedPortState &port = simulatedGpio().ports[steroido_intern::simulatedLookup(SimulatedGpio::portOf(pin))];
+    simulatedGpio().accesses++;
+    return (port.pins() & SimulatedGpio::maskOf(pin)) ? HIGH : LOW;
+}
+
+#endif // SIMULATED_GPIO_H
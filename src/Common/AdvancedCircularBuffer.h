@@ -1,19 +1,46 @@
 #ifndef ADVANCED_CIRCULAR_BUFFER_H
 #define ADVANCED_CIRCULAR_BUFFER_H
 
+#include "memCpy.h"
 #include "memSet.h"
 #include "stdint.h"
-
-template <typename T, size_t BufferSize, typename CounterType = size_t>
+#include "RingIndex.h"
+#include "OverflowPolicy.h"
+
+/**
+ * @brief Circular Buffer with access to all contained elements
+ *
+ * @tparam T The Type of the saved object/datatype
+ * @tparam BufferSize The Size of the buffer (element count). A power of two avoids all wrap-around
+ * compares.
+ * @tparam CounterType The Type the buffer will count the elements, must be unsigned
+ * @tparam Policy What to do with new elements if the container is full (OverwriteOldest or
+ * RejectNewest)
+ */
+template <typename T, size_t BufferSize, typename CounterType = size_t,
+          OverflowPolicy Policy = OverwriteOldest>
 class AdvancedCircularBuffer {
+    typedef steroido_intern::RingIndex<CounterType, BufferSize> Index;
+
+    template <typename ValueType, bool Forward>
+    class _Iterator;
+
    public:
+    typedef BufferSegment<T, CounterType> Segment;
+
+    // Forward iterators go from the tail to the head (oldest first), reverse ones the other way
+    typedef _Iterator<T, true> iterator;
+    typedef _Iterator<const T, true> const_iterator;
+    typedef _Iterator<T, false> reverse_iterator;
+    typedef _Iterator<const T, false> const_reverse_iterator;
+
     // ----------------------------------------- Constructors
 
     /**
      * @brief Construct a new Advanced Circular Buffer
      *
      */
-    AdvancedCircularBuffer() : _tail(0), _head(0), _full(false) {}
+    AdvancedCircularBuffer() {}
 
     /**
      * @brief Construct a new Advanced Circular Buffer object
@@ -28,52 +55,48 @@ class AdvancedCircularBuffer {
 
     /**
      * @brief Push a new Object to the End of the Container. If the Container is full, the oldest
-     * element will be overwritten!
+     * element will be overwritten (OverwriteOldest) or the new one dropped (RejectNewest)!
      *
      * @param object
+     * @return true if the object was pushed
+     * @return false if the container is full and rejects new objects
      */
-    void push(const T& data) {
+    bool push(const T& data) {
         if (full()) {
-            _tail++;
-            if (_tail == BufferSize) {
-                _tail = 0;
-            }
-        }
-        _pool[_head++] = data;
-        if (_head == BufferSize) {
-            _head = 0;
-        }
-        if (_head == _tail) {
-            _full = true;
+            _statistics.dropped();
+            if (Policy == RejectNewest) return false;
+            _index.advanceTail(1);
         }
+        _pool[_index.headSlot()] = data;
+        _index.advanceHead(1);
+        _statistics.filled(size());
+        return true;
     }
 
     /**
      * @brief Push a new Object to the Beginning of the Container. If the Container is full, the
-     * oldest element will be overwritten! A following pop() would return this element next.
+     * oldest element will be overwritten (OverwriteOldest) or the new one dropped (RejectNewest)!
+     * A following pop() would return this element next.
      *
      * @param object
+     * @return true if the object was pushed
+     * @return false if the container is full and rejects new objects
      */
-    void pushBack(const T& data) {
+    bool pushBack(const T& data) {
         // Check full, if so drop oldest object (not newest)
         if (full()) {
+            _statistics.dropped();
+            if (Policy == RejectNewest) return false;
+
             // Just overwrite tail
-            _pool[_tail] = data;
+            _pool[_index.tailSlot()] = data;
         } else {
-            // Calculate new tail
-            if (_tail == 0) {
-                _tail = BufferSize - 1;
-            } else {
-                --_tail;
-            }
-
             // Insert into new Tail
-            _pool[_tail] = data;
-
-            if (_head == _tail) {
-                _full = true;
-            }
+            _index.retreatTail(1);
+            _pool[_index.tailSlot()] = data;
+            _statistics.filled(size());
         }
+        return true;
     }
 
     /**
@@ -87,11 +110,8 @@ class AdvancedCircularBuffer {
     bool pop(T& data) {
         bool data_popped = false;
         if (!empty()) {
-            data = _pool[_tail++];
-            if (_tail == BufferSize) {
-                _tail = 0;
-            }
-            _full = false;
+            data = _pool[_index.tailSlot()];
+            _index.advanceTail(1);
             data_popped = true;
         }
         return data_popped;
@@ -108,7 +128,7 @@ class AdvancedCircularBuffer {
     bool peek(T& data) const {
         bool data_updated = false;
         if (!empty()) {
-            data = _pool[_tail];
+            data = _pool[_index.tailSlot()];
             data_updated = true;
         }
         return data_updated;
@@ -161,7 +181,7 @@ class AdvancedCircularBuffer {
         bool data_updated = false;
         if (!empty()) {
             if (size() > index) {
-                data = _pool[_getElementIndexFromHead(index)];
+                data = _pool[_index.slotFromHead(index)];
                 data_updated = true;
             }
         }
@@ -175,7 +195,7 @@ class AdvancedCircularBuffer {
      * @param index
      * @return T&
      */
-    T& getReferenceFromHead(CounterType index) { return _pool[_getElementIndexFromHead(index)]; }
+    T& getReferenceFromHead(CounterType index) { return _pool[_index.slotFromHead(index)]; }
 
     /**
      * @brief Get the Object with the index-distance from tail. The object will be written into the
@@ -190,7 +210,7 @@ class AdvancedCircularBuffer {
         bool data_updated = false;
         if (!empty()) {
             if (size() > index) {
-                data = _pool[_getElementIndexFromTail(index)];
+                data = _pool[_index.slotFromTail(index)];
                 data_updated = true;
             }
         }
@@ -204,7 +224,7 @@ class AdvancedCircularBuffer {
      * @param index
      * @return T&
      */
-    T& getReferenceFromTail(CounterType index) { return _pool[_getElementIndexFromTail(index)]; }
+    T& getReferenceFromTail(CounterType index) { return _pool[_index.slotFromTail(index)]; }
 
     // ----------------------------------------- Size -----------------------------------------
 
@@ -214,7 +234,7 @@ class AdvancedCircularBuffer {
      * @return true
      * @return false
      */
-    bool full() const { return _full; }
+    bool full() const { return _index.full(); }
 
     /**
      * @brief Returns true, if the container is empty
@@ -222,29 +242,14 @@ class AdvancedCircularBuffer {
      * @return true
      * @return false
      */
-    bool empty() const {
-        bool is_empty = (_head == _tail) && !_full;
-        return is_empty;
-    }
+    bool empty() const { return _index.empty(); }
 
     /**
      * @brief Returns the element count currently in the container
      *
      * @return CounterType amount of objects currently in the container
      */
-    CounterType size() const {
-        CounterType elements;
-        if (!_full) {
-            if (_head < _tail) {
-                elements = BufferSize + _head - _tail;
-            } else {
-                elements = _head - _tail;
-            }
-        } else {
-            elements = BufferSize;
-        }
-        return elements;
-    }
+    CounterType size() const { return _index.size(); }
 
     /**
      * @brief Returns how many elements can still be stored additionally in the buffer
@@ -257,7 +262,8 @@ class AdvancedCircularBuffer {
 
     /**
      * @brief Special function to delete random element in the buffer. The given Index is based on
-     * the Head -> index 2 is 2 elements away from the head element.
+     * the Head -> index 2 is 2 elements away from the head element. Only the elements on the
+     * shorter side of the deleted one are moved.
      *
      * @param index
      * @return true Element got deleted
@@ -266,19 +272,15 @@ class AdvancedCircularBuffer {
     bool deleteFromHead(CounterType index) {
         if (index >= size()) return false;
 
-        for (CounterType i = index; i < size() - 1; ++i) {
-            _pool[_getElementIndexFromHead(i)] = _pool[_getElementIndexFromHead(i + 1)];
-        }
-
-        _tail = _addToCounter(_tail, 1);
-        _full = false;
+        _erase(size() - 1 - index, 1);
 
         return true;
     }
 
     /**
      * @brief Special function to delete random element in the buffer. The given Index is based on
-     * the Tail -> index 2 is 2 elements away from the tail element.
+     * the Tail -> index 2 is 2 elements away from the tail element. Only the elements on the
+     * shorter side of the deleted one are moved.
      *
      * @param index
      * @return true Element got deleted
@@ -287,12 +289,41 @@ class AdvancedCircularBuffer {
     bool deleteFromTail(CounterType index) {
         if (index >= size()) return false;
 
-        for (CounterType i = index; i < size() - 1; ++i) {
-            _pool[_getElementIndexFromTail(i)] = _pool[_getElementIndexFromTail(i + 1)];
-        }
+        _erase(index, 1);
 
-        _head = _removeFromCounter(_head, 1);
-        _full = false;
+        return true;
+    }
+
+    /**
+     * @brief Delete multiple neighbouring elements at once, moving the remaining ones only once.
+     * The given Index is based on the Tail, same as deleteFromTail().
+     *
+     * @param index of the first (oldest) element to be deleted
+     * @param amount count of elements to be deleted
+     * @return true If the element(s) got deleted
+     * @return false Invalid index or amount
+     */
+    bool deleteRangeFromTail(CounterType index, CounterType amount) {
+        if (index >= size() || amount > size() - index) return false;
+
+        _erase(index, amount);
+
+        return true;
+    }
+
+    /**
+     * @brief Delete random element in O(1) by moving the newest element into its place. Use it
+     * if the order of the elements does not matter. The given Index is based on the Tail.
+     *
+     * @param index
+     * @return true Element got deleted
+     * @return false Invalid Index
+     */
+    bool deleteFromTailUnordered(CounterType index) {
+        if (index >= size()) return false;
+
+        _pool[_index.slotFromTail(index)] = _pool[_index.slotFromHead(0)];
+        _index.retreatHead(1);
 
         return true;
     }
@@ -307,8 +338,7 @@ class AdvancedCircularBuffer {
     bool deleteAmountFromHead(CounterType amount) {
         if (amount > size() || amount < 0) return false;
 
-        _head = _removeFromCounter(_head, amount);
-        _full = false;
+        _index.retreatHead(amount);
 
         return true;
     }
@@ -323,8 +353,7 @@ class AdvancedCircularBuffer {
     bool deleteAmountFromTail(CounterType amount) {
         if (amount > size() || amount < 0) return false;
 
-        _tail = _addToCounter(_tail, amount);
-        _full = false;
+        _index.advanceTail(amount);
 
         return true;
     }
@@ -336,34 +365,59 @@ class AdvancedCircularBuffer {
      * @return true if the element was deleted
      * @return false if the element has not been in the container
      */
-    bool deleteElement(T& element) {
+    bool deleteElement(const T& element) {
+        CounterType slot = _index.tailSlot();
         CounterType currentSize = size();
 
         for (CounterType i = 0; i < currentSize; ++i) {
-            if (_pool[_getElementIndexFromTail(i)] == element) {
-                if (i < (currentSize - 1) / 2) {
-                    return deleteFromHead(--currentSize -
-                                          i);   // currentSize will not be used anymore, so using
-                                                // this instead of currentsize-1
-                } else {
-                    return deleteFromTail(i);
-                }
+            if (_pool[slot] == element) {
+                _erase(i, 1);
+                return true;
             }
+            slot = Index::nextSlot(slot);
         }
 
         return false;
     }
 
     /**
-     * @brief Reset the container
+     * @brief Delete all elements the predicate returns true for in a single pass, keeping the
+     * order of the others. Can be used for lazy deletion: mark elements as deleted (tombstones,
+     * e.g. an acknowledged flag in the element) and compact the container once in a while.
+     * Compacts towards the head, so deleted elements at the tail (oldest ones) cause no copying.
      *
+     * @tparam Predicate bool(const T&), e.g. a function pointer or a lambda
+     * @param predicate
+     * @return CounterType count of deleted elements
      */
-    void reset() {
-        _head = 0;
-        _tail = 0;
-        _full = false;
+    template <typename Predicate>
+    CounterType deleteIf(Predicate predicate) {
+        CounterType currentSize = size();
+        CounterType read = _index.slotFromHead(0);
+        CounterType write = read;
+        CounterType deleted = 0;
+
+        for (CounterType i = 0; i < currentSize; ++i) {
+            if (predicate(static_cast<const T&>(_pool[read]))) {
+                ++deleted;
+            } else {
+                if (deleted) _pool[write] = _pool[read];
+                write = Index::previousSlot(write);
+            }
+            read = Index::previousSlot(read);
+        }
+
+        _index.advanceTail(deleted);
+
+        return deleted;
     }
 
+    /**
+     * @brief Reset the container
+     *
+     */
+    void reset() { _index.reset(); }
+
     /**
      * @brief Drop the oldest object (the tail-object)
      *
@@ -373,85 +427,326 @@ class AdvancedCircularBuffer {
     bool dropLast() {
         bool data_dropped = false;
         if (!empty()) {
-            if (++_tail == BufferSize) {
-                _tail = 0;
-            }
-            _full = false;
+            _index.advanceTail(1);
             data_dropped = true;
         }
         return data_dropped;
     }
 
-   private:
-    T _pool[BufferSize];
-    CounterType _tail, _head;
-    bool _full;
+    // ----------------------------------------- Bulk Access
 
-    // ----------------------------------------- Addition / Subtraction
+    /**
+     * @brief Push multiple Objects to the End of the Container at once. Same as calling push() for
+     * each of them, so if there is not enough space, the oldest elements will be overwritten
+     * (OverwriteOldest) or the last objects of the array dropped (RejectNewest)!
+     *
+     * @param data Array of the objects
+     * @param count Count of objects in the array
+     * @return CounterType count of objects now stored from the array (only the newest BufferSize
+     * ones if more were given, only the first fitting ones for RejectNewest)
+     */
+    CounterType push(const T* data, CounterType count) {
+        CounterType freeSpace = leftCapacity();
+        if (count > freeSpace) {
+            _statistics.dropped(count - freeSpace);
+
+            if (Policy == RejectNewest) {
+                count = freeSpace;
+            } else {
+                if (count > BufferSize) {
+                    data += count - BufferSize;
+                    count = BufferSize;
+                }
+                _index.advanceTail(count - freeSpace);
+            }
+        }
+
+        Segment first, second;
+        writeSegments(first, second);
+        _copyIntoSegments(first, second, data, count);
+        _index.advanceHead(count);
+        _statistics.filled(size());
+
+        return count;
+    }
 
     /**
-     * @brief Add a given Amount to a given counter
+     * @brief Pop multiple Objects out of the buffer at once, oldest first
      *
-     * @param counter
-     * @param amount
-     * @return CounterType The new counter value
+     * @param data Array the objects get written to
+     * @param count Maximum count of objects to be popped
+     * @return CounterType count of objects actually popped
      */
-    CounterType _addToCounter(CounterType counter, CounterType amount) const {
-        CounterType counterSubtract;
-        amount %= BufferSize;
+    CounterType pop(T* data, CounterType count) {
+        Segment first, second;
+        CounterType available = readSegments(first, second);
+        if (count > available) count = available;
 
-        counterSubtract = BufferSize - amount;
-        counterSubtract %= BufferSize;
+        _copyFromSegments(first, second, data, count);
+        _index.advanceTail(count);
 
-        return _removeFromCounter(counter, counterSubtract);
+        return count;
     }
 
     /**
-     * @brief Remove a given Amount from a given counter
+     * @brief Get the (at most two) contiguous parts holding the stored elements, oldest first.
+     * Process the elements in place and release() them afterwards (if wanted).
      *
-     * @param counter
-     * @param amount
-     * @return CounterType The new counter value
+     * @param first Segment starting with the tail element
+     * @param second Segment following the first one (length 0 if not wrapped)
+     * @return CounterType count of readable elements in total
      */
-    CounterType _removeFromCounter(CounterType counter, CounterType amount) const {
-        CounterType newCounterVal;
-        amount %= BufferSize;
+    CounterType readSegments(Segment& first, Segment& second) {
+        CounterType count = size();
+        CounterType tail = _index.tailSlot();
+        CounterType untilEnd = BufferSize - tail;
 
-        if (counter < amount) {
-            newCounterVal = amount - counter;
-            newCounterVal = BufferSize - newCounterVal;
-        } else {
-            newCounterVal = counter - amount;
+        first.data = &_pool[tail];
+        first.length = count < untilEnd ? count : untilEnd;
+        second.data = _pool;
+        second.length = count - first.length;
+
+        return count;
+    }
+
+    /**
+     * @brief Get the (at most two) contiguous free parts of the buffer. Write the new elements
+     * directly into them (first segment first) and commit() them afterwards.
+     *
+     * @param first Segment starting behind the head element
+     * @param second Segment following the first one (length 0 if not wrapped)
+     * @return CounterType count of free places in total
+     */
+    CounterType writeSegments(Segment& first, Segment& second) {
+        CounterType count = leftCapacity();
+        CounterType head = _index.headSlot();
+        CounterType untilEnd = BufferSize - head;
+
+        first.data = &_pool[head];
+        first.length = count < untilEnd ? count : untilEnd;
+        second.data = _pool;
+        second.length = count - first.length;
+
+        return count;
+    }
+
+    /**
+     * @brief Add elements written into the writeSegments() (or the reserve()d place) to the end of
+     * the container
+     *
+     * @param count Count of written elements, must not exceed the left capacity
+     */
+    void commit(CounterType count = 1) {
+        _index.advanceHead(count);
+        _statistics.filled(size());
+    }
+
+    /**
+     * @brief Remove the oldest elements, same as deleteAmountFromTail() without checks
+     *
+     * @param count Count of elements to be removed, must not exceed the size
+     */
+    void release(CounterType count = 1) { _index.advanceTail(count); }
+
+    // ----------------------------------------- Zero-Copy Access
+
+    /**
+     * @brief Get the place behind the head element to write a new object in place, then commit()
+     * it. If the container is full, the oldest element will be dropped (OverwriteOldest), same as
+     * push().
+     *
+     * @return T* place for the new object, valid until the next modification of the container.
+     * nullptr if the container is full and rejects new objects (RejectNewest).
+     */
+    T* reserve() {
+        if (full()) {
+            _statistics.dropped();
+            if (Policy == RejectNewest) return nullptr;
+            _index.advanceTail(1);
         }
+        return &_pool[_index.headSlot()];
+    }
 
-        return newCounterVal;
+    /**
+     * @brief Get the oldest object in place, without copying it. release() it afterwards.
+     *
+     * @return T* the oldest object or nullptr if the container is empty
+     */
+    T* peek() {
+        if (empty()) return nullptr;
+        return &_pool[_index.tailSlot()];
+    }
+
+    /**
+     * @brief Get the oldest object in place, without copying it
+     *
+     * @return const T* the oldest object or nullptr if the container is empty
+     */
+    const T* peek() const {
+        if (empty()) return nullptr;
+        return &_pool[_index.tailSlot()];
     }
 
-    // ----------------------------------------- Index Calculators
+    // ----------------------------------------- Iterators
 
     /**
-     * @brief Get the elementIndex (to be used for accessing elements in the _pool) by giving an
-     * index, representing the index based on the head (index = 0 == last element index)
+     * @brief Iterator on the tail element (oldest first). Use it for range-for loops.
      *
-     * @param index
-     * @return CounterType
+     * @return iterator
+     */
+    iterator begin() { return iterator(_pool, _index.tailSlot(), size()); }
+    const_iterator begin() const { return const_iterator(_pool, _index.tailSlot(), size()); }
+
+    /**
+     * @brief Iterator behind the head element
+     *
+     * @return iterator
      */
-    CounterType _getElementIndexFromHead(CounterType index) const {
-        index %= BufferSize;
-        ++index;   // ++ because the head is pointing to the element behind the last element
+    iterator end() { return iterator(_pool, _index.headSlot(), 0); }
+    const_iterator end() const { return const_iterator(_pool, _index.headSlot(), 0); }
 
-        return _removeFromCounter(_head, index);
+    /**
+     * @brief Reverse Iterator on the head element (newest first)
+     *
+     * @return reverse_iterator
+     */
+    reverse_iterator rbegin() { return reverse_iterator(_pool, _index.slotFromHead(0), size()); }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(_pool, _index.slotFromHead(0), size());
     }
 
     /**
-     * @brief Get the elementIndex (to be used for accessing elements in the _pool) by giving an
-     * index, representing the index based on the tail (index = 0 == first element index)
+     * @brief Reverse Iterator in front of the tail element
+     *
+     * @return reverse_iterator
+     */
+    reverse_iterator rend() { return reverse_iterator(_pool, _index.tailSlot(), 0); }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(_pool, _index.tailSlot(), 0);
+    }
+
+    // ----------------------------------------- Statistics
+
+    /**
+     * @brief Returns the count of objects lost since the last resetStatistics(), either
+     * overwritten or rejected
+     *
+     * @return uint32_t
+     */
+    uint32_t dropCount() const { return _statistics.dropCount(); }
+
+    /**
+     * @brief Returns the highest count of objects stored at once since the last resetStatistics()
+     * (high-water mark). Use it to size the container.
      *
-     * @param index
      * @return CounterType
      */
-    CounterType _getElementIndexFromTail(CounterType index) const {
-        return _addToCounter(_tail, index);
+    CounterType peakSize() const { return _statistics.peakSize(); }
+
+    /**
+     * @brief Reset the drop count and the high-water mark. reset() keeps them on purpose.
+     *
+     */
+    void resetStatistics() { _statistics.reset(); }
+
+   private:
+    T _pool[BufferSize];
+    Index _index;
+    steroido_intern::OverflowStatistics<CounterType> _statistics;
+
+    /**
+     * @brief Iterator stepping slot by slot through the pool, so each step is a single
+     * increment-and-wrap instead of a full index calculation. Two iterators are equal if the same
+     * count of elements is left to iterate.
+     *
+     * @tparam ValueType T or const T
+     * @tparam Forward true to go from the tail to the head
+     */
+    template <typename ValueType, bool Forward>
+    class _Iterator {
+       public:
+        _Iterator(ValueType* pool, CounterType slot, CounterType remaining)
+            : _pool(pool), _slot(slot), _remaining(remaining) {}
+
+        ValueType& operator*() const { return _pool[_slot]; }
+        ValueType* operator->() const { return &_pool[_slot]; }
+
+        _Iterator& operator++() {
+            _slot = Forward ? Index::nextSlot(_slot) : Index::previousSlot(_slot);
+            --_remaining;
+            return *this;
+        }
+
+        _Iterator operator++(int) {
+            _Iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        bool operator==(const _Iterator& that) const { return _remaining == that._remaining; }
+        bool operator!=(const _Iterator& that) const { return _remaining != that._remaining; }
+
+       private:
+        ValueType* _pool;
+        CounterType _slot;
+        CounterType _remaining;
+    };
+
+    /**
+     * @brief Delete amount elements starting index elements away from the tail by moving the
+     * elements on the shorter side over them. Index and amount must be valid!
+     *
+     * @param index
+     * @param amount
+     */
+    void _erase(CounterType index, CounterType amount) {
+        if (!amount) return;
+
+        CounterType behind = size() - index - amount;
+
+        if (index < behind) {
+            // Move the older elements towards the head, starting next to the gap
+            CounterType to = _index.slotFromTail(index + amount - 1);
+            CounterType from = Index::previousSlot(_index.slotFromTail(index));
+            for (CounterType i = 0; i < index; ++i) {
+                _pool[to] = _pool[from];
+                to = Index::previousSlot(to);
+                from = Index::previousSlot(from);
+            }
+            _index.advanceTail(amount);
+        } else {
+            // Move the newer elements towards the tail
+            CounterType to = _index.slotFromTail(index);
+            CounterType from = _index.slotFromTail(index + amount);
+            for (CounterType i = 0; i < behind; ++i) {
+                _pool[to] = _pool[from];
+                to = Index::nextSlot(to);
+                from = Index::nextSlot(from);
+            }
+            _index.retreatHead(amount);
+        }
+    }
+
+    // ----------------------------------------- Segment Copy
+
+    static void _copyIntoSegments(const Segment& first, const Segment& second, const T* data,
+                                  CounterType count) {
+        if (count <= first.length) {
+            memCpy<T>(first.data, data, count);
+        } else {
+            memCpy<T>(first.data, data, first.length);
+            memCpy<T>(second.data, data + first.length, count - first.length);
+        }
+    }
+
+    static void _copyFromSegments(const Segment& first, const Segment& second, T* data,
+                                  CounterType count) {
+        if (count <= first.length) {
+            memCpy<T>(data, first.data, count);
+        } else {
+            memCpy<T>(data, first.data, first.length);
+            memCpy<T>(data + first.length, second.data, count - first.length);
+        }
     }
 };
 
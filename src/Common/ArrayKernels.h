@@ -0,0 +1,215 @@
+#ifndef ARRAY_KERNELS_H
+#define ARRAY_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "FastMap.h"
+
+#if defined(NATIVE) && defined(__SSE2__)
+    #include <emmintrin.h>
+    #define STEROIDO_ARRAY_KERNELS_SSE2
+#endif
+
+/*
+    Kernels working on whole blocks of samples (e.g. all raw ADC counts of a cycle) in one call. The
+    loops are simple and the arrays must not overlap (__restrict__), so the compiler can unroll and
+    vectorize them. Native builds with SSE2 process 4 floats at once for the common float cases.
+    Kernels taking a single array work in place.
+*/
+
+/**
+ * @brief Convert elements to another type (e.g. uint16_t ADC counts to float)
+ *
+ * @tparam T Destination type
+ * @tparam S Source type
+ * @param dest Destination, must not overlap with src
+ * @param src
+ * @param count Count of elements (! NOT BYTES !)
+ */
+template<typename T, typename S>
+void convertArray(T* __restrict__ dest, const S* __restrict__ src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = static_cast<T>(src[i]);
+    }
+}
+
+/**
+ * @brief Map elements with a precomputed mapper (LinearMap, FixedLinearMap, PiecewiseLinearMap,
+ * or anything else callable with a value)
+ *
+ * @tparam T Destination type
+ * @tparam S Source type
+ * @tparam Mapper
+ * @param dest Destination, must not overlap with src
+ * @param src
+ * @param count Count of elements (! NOT BYTES !)
+ * @param mapper
+ */
+template<typename T, typename S, class Mapper>
+void mapArray(T* __restrict__ dest, const S* __restrict__ src, size_t count, const Mapper &mapper) {
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = static_cast<T>(mapper(src[i]));
+    }
+}
+
+/**
+ * @brief Limit elements to a range
+ *
+ * @tparam T
+ * @param dest Destination, must not overlap with src
+ * @param src
+ * @param count Count of elements (! NOT BYTES !)
+ * @param low
+ * @param high
+ */
+template<typename T>
+void clampArray(T* __restrict__ dest, const T* __restrict__ src, size_t count, T low, T high) {
+    for (size_t i = 0; i < count; i++) {
+        T value = src[i] < low ? low : src[i];
+        dest[i] = value > high ? high : value;
+    }
+}
+
+template<typename T>
+void clampArray(T* data, size_t count, T low, T high) {
+    for (size_t i = 0; i < count; i++) {
+        T value = data[i] < low ? low : data[i];
+        data[i] = value > high ? high : value;
+    }
+}
+
+/**
+ * @brief Multiply elements with a factor
+ *
+ * @tparam T
+ * @param dest Destination, must not overlap with src
+ * @param src
+ * @param count Count of elements (! NOT BYTES !)
+ * @param factor
+ */
+template<typename T>
+void scaleArray(T* __restrict__ dest, const T* __restrict__ src, size_t count, T factor) {
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = src[i] * factor;
+    }
+}
+
+template<typename T>
+void scaleArray(T* data, size_t count, T factor) {
+    for (size_t i = 0; i < count; i++) {
+        data[i] *= factor;
+    }
+}
+
+/**
+ * @brief Add an offset to elements
+ *
+ * @tparam T
+ * @param dest Destination, must not overlap with src
+ * @param src
+ * @param count Count of elements (! NOT BYTES !)
+ * @param offset
+ */
+template<typename T>
+void offsetArray(T* __restrict__ dest, const T* __restrict__ src, size_t count, T offset) {
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = src[i] + offset;
+    }
+}
+
+template<typename T>
+void offsetArray(T* data, size_t count, T offset) {
+    for (size_t i = 0; i < count; i++) {
+        data[i] += offset;
+    }
+}
+
+
+#ifdef STEROIDO_ARRAY_KERNELS_SSE2
+    namespace steroido_intern {
+        /**
+         * @brief Load 8 uint16_t and widen them to two vectors of 4 floats
+         *
+         */
+        inline void _loadU16AsFloat(const uint16_t *src, __m128 &low, __m128 &high) {
+            __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            __m128i zero = _mm_setzero_si128();
+            low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(raw, zero));
+            high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(raw, zero));
+        }
+    };
+
+    inline void convertArray(float* __restrict__ dest, const uint16_t* __restrict__ src, size_t count) {
+        const size_t vectorCount = count - count % 8;
+        size_t i = 0;
+        for (; i < vectorCount; i += 8) {
+            __m128 low, high;
+            steroido_intern::_loadU16AsFloat(src + i, low, high);
+            _mm_storeu_ps(dest + i, low);
+            _mm_storeu_ps(dest + i + 4, high);
+        }
+        for (; i < count; i++) {
+            dest[i] = src[i];
+        }
+    }
+
+    inline void mapArray(float* __restrict__ dest, const uint16_t* __restrict__ src, size_t count, const LinearMap<float> &mapper) {
+        const __m128 scale = _mm_set1_ps(mapper.scale());
+        const __m128 offset = _mm_set1_ps(mapper.offset());
+        const size_t vectorCount = count - count % 8;
+        size_t i = 0;
+        for (; i < vectorCount; i += 8) {
+            __m128 low, high;
+            steroido_intern::_loadU16AsFloat(src + i, low, high);
+            _mm_storeu_ps(dest + i, _mm_add_ps(_mm_mul_ps(low, scale), offset));
+            _mm_storeu_ps(dest + i + 4, _mm_add_ps(_mm_mul_ps(high, scale), offset));
+        }
+        for (; i < count; i++) {
+            dest[i] = mapper(src[i]);
+        }
+    }
+
+    inline void mapArray(float* __restrict__ dest, const float* __restrict__ src, size_t count, const LinearMap<float> &mapper) {
+        const __m128 scale = _mm_set1_ps(mapper.scale());
+        const __m128 offset = _mm_set1_ps(mapper.offset());
+        const size_t vectorCount = count - count % 4;
+        size_t i = 0;
+        for (; i < vectorCount; i += 4) {
+            _mm_storeu_ps(dest + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), offset));
+        }
+        for (; i < count; i++) {
+            dest[i] = mapper(src[i]);
+        }
+    }
+
+    // max/min return their second operand for NaN, so NaN samples pass through like in the loops above
+    inline void clampArray(float* __restrict__ dest, const float* __restrict__ src, size_t count, float low, float high) {
+        const __m128 lowVector = _mm_set1_ps(low);
+        const __m128 highVector = _mm_set1_ps(high);
+        const size_t vectorCount = count - count % 4;
+        size_t i = 0;
+        for (; i < vectorCount; i += 4) {
+            _mm_storeu_ps(dest + i, _mm_min_ps(highVector, _mm_max_ps(lowVector, _mm_loadu_ps(src + i))));
+        }
+        for (; i < count; i++) {
+            float value = src[i] < low ? low : src[i];
+            dest[i] = value > high ? high : value;
+        }
+    }
+
+    inline void clampArray(float* data, size_t count, float low, float high) {
+        const __m128 lowVector = _mm_set1_ps(low);
+        const __m128 highVector = _mm_set1_ps(high);
+        const size_t vectorCount = count - count % 4;
+        size_t i = 0;
+        for (; i < vectorCount; i += 4) {
+            _mm_storeu_ps(data + i, _mm_min_ps(highVector, _mm_max_ps(lowVector, _mm_loadu_ps(data + i))));
+        }
+        for (; i < count; i++) {
+            float value = data[i] < low ? low : data[i];
+            data[i] = value > high ? high : value;
+        }
+    }
+#endif
+
+#endif // ARRAY_KERNELS_H
@@ -1,6 +1,8 @@
 #ifndef CALLBACK_H
 #define CALLBACK_H
 
+#include "PoolAllocator.h"
+
 typedef uint32_t callback_instance_counter_type_t;
 
 namespace steroido_intern {
@@ -14,6 +16,16 @@ namespace steroido_intern {
         public:
             virtual ~Callable() {}
             virtual R call() = 0;
+
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                static void* operator new(size_t size) {
+                    return steroido_intern::allocate(size);
+                }
+
+                static void operator delete(void* ptr) {
+                    steroido_intern::deallocate(ptr);
+                }
+            #endif
     };
 };
 
@@ -25,7 +37,7 @@ class Callback {
          * 
          */
         Callback() : _callback(nullptr) {
-            _instanceCount = new callback_instance_counter_type_t;
+            _instanceCount = _newInstanceCount();
             *_instanceCount = 0;
         }
 
@@ -36,7 +48,7 @@ class Callback {
          */
         Callback(R(*func)()) {
             _callback = new FunctionCaller(func);
-            _instanceCount = new callback_instance_counter_type_t;
+            _instanceCount = _newInstanceCount();
             *_instanceCount = 1;
         }
 
@@ -51,7 +63,7 @@ class Callback {
         template<typename T, typename U>
         Callback(U* obj, R(T::*method)()) {
             _callback = new MethodCaller<T, U>(obj, method);
-            _instanceCount = new callback_instance_counter_type_t;
+            _instanceCount = _newInstanceCount();
             *_instanceCount = 1;
         }
 
@@ -68,8 +80,8 @@ class Callback {
          * 
          * @param that 
          */
-        Callback(const Callback<R> &that) {
-            _copy(that);
+        Callback(const Callback<R> &that) : _callback(that._callback), _instanceCount(that._instanceCount) {
+            ++(*_instanceCount);
         }
 
         /**
@@ -100,13 +112,29 @@ class Callback {
 
         void _destruct() {
             if (!(*_instanceCount)) {
-                delete _instanceCount;
+                _deleteInstanceCount(_instanceCount);
             } else if (!(--(*_instanceCount))) {
                 delete _callback;
-                delete _instanceCount;
+                _deleteInstanceCount(_instanceCount);
             }
         }
 
+        static callback_instance_counter_type_t* _newInstanceCount() {
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                return static_cast<callback_instance_counter_type_t*>(steroido_intern::allocate(sizeof(callback_instance_counter_type_t)));
+            #else
+                return new callback_instance_counter_type_t;
+            #endif
+        }
+
+        static void _deleteInstanceCount(callback_instance_counter_type_t *instanceCount) {
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                steroido_intern::deallocate(instanceCount);
+            #else
+                delete instanceCount;
+            #endif
+        }
+
         Callback<R>& _copy(const Callback<R> &that) {
             _destruct();
 
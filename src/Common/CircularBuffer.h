@@ -1,43 +1,50 @@
 #ifndef CIRCULARBUFFER_H
 #define CIRCULARBUFFER_H
 
+#include "RingIndex.h"
+#include "OverflowPolicy.h"
+#include "memCpy.h"
+
 /**
  * @brief Buffer to save things in static storage in a circle
  * 
  * @tparam T The Type of the saved object/datatype
  * @tparam BufferSize The Size of the buffer (element count)
  * @tparam CounterType The Type the buffer will count the elements
- * @note CounterType must be unsigned and consistent with BufferSize
+ * @tparam Policy What to do with new elements if the buffer is full (OverwriteOldest or RejectNewest)
+ * @note CounterType must be unsigned and consistent with BufferSize. A power of two BufferSize
+ * avoids all wrap-around compares.
  */
-template<typename T, uint16_t BufferSize, typename CounterType = uint16_t>
+template<typename T, uint16_t BufferSize, typename CounterType = uint16_t, OverflowPolicy Policy = OverwriteOldest>
 class CircularBuffer {
     public:
+        typedef BufferSegment<T, CounterType> Segment;
+
         /**
          * @brief Construct a new Circular Buffer
          * 
          */
-        CircularBuffer() : _head(0), _tail(0), _full(false) {}
+        CircularBuffer() {}
         ~CircularBuffer() {}
 
         /**
-         * @brief Push the data to the buffer. This overwrites the buffer if it's full
+         * @brief Push the data to the buffer. If it's full, the oldest element gets overwritten
+         * (OverwriteOldest) or the data gets dropped (RejectNewest).
          * 
          * @param data Data to be pushed to the buffer
+         * @return true if the data got pushed
+         * @return false if the buffer is full and rejects new data
          */
-        void push(const T &data) {
+        bool push(const T &data) {
             if (full()) {
-                _tail++;
-                if (_tail == BufferSize) {
-                    _tail = 0;
-                }
-            }
-            _pool[_head++] = data;
-            if (_head == BufferSize) {
-                _head = 0;
-            }
-            if (_head == _tail) {
-                _full = true;
+                _statistics.dropped();
+                if (Policy == RejectNewest) return false;
+                _index.advanceTail(1);
             }
+            _pool[_index.headSlot()] = data;
+            _index.advanceHead(1);
+            _statistics.filled(size());
+            return true;
         }
 
         /**
@@ -49,11 +56,8 @@ class CircularBuffer {
         bool pop(T &data) {
             bool data_popped = false;
             if (!empty()) {
-                data = _pool[_tail++];
-                if (_tail == BufferSize) {
-                    _tail = 0;
-                }
-                _full = false;
+                data = _pool[_index.tailSlot()];
+                _index.advanceTail(1);
                 data_popped = true;
             }
             return data_popped;
@@ -66,8 +70,7 @@ class CircularBuffer {
          * @return false if one or more elements are in the buffer
          */
         bool empty() const {
-            bool is_empty = (_head == _tail) && !_full;
-            return is_empty;
+            return _index.empty();
         }
 
         /**
@@ -77,8 +80,7 @@ class CircularBuffer {
          * @return false if one or more places are empty
          */
         bool full() const {
-            bool full = _full;
-            return full;
+            return _index.full();
         }
         
         /**
@@ -86,9 +88,7 @@ class CircularBuffer {
          * 
          */
         void reset() {
-            _head = 0;
-            _tail = 0;
-            _full = false;
+            _index.reset();
         }
 
         /**
@@ -97,17 +97,7 @@ class CircularBuffer {
          * @return CounterType number of elements currently stored in the buffer
          */
         CounterType size() const {
-            CounterType elements;
-            if (!_full) {
-                if (_head < _tail) {
-                    elements = BufferSize + _head - _tail;
-                } else {
-                    elements = _head - _tail;
-                }
-            } else {
-                elements = BufferSize;
-            }
-            return elements;
+            return _index.size();
         }
 
         /**
@@ -120,17 +110,227 @@ class CircularBuffer {
         bool peek(T &data) const {
             bool data_updated = false;
             if (!empty()) {
-                data = _pool[_tail];
+                data = _pool[_index.tailSlot()];
                 data_updated = true;
             }
             return data_updated;
         }
 
+        /**
+         * @brief Returns how many elements can still be stored without overwriting old ones
+         * 
+         * @return CounterType the leftover capacity
+         */
+        CounterType leftCapacity() const {
+            return BufferSize - size();
+        }
+
+        // ----------------------------------------- Bulk Access
+
+        /**
+         * @brief Push multiple elements at once. Same as calling push() for each of them, so if there
+         * is not enough space, the oldest elements get overwritten (OverwriteOldest) or the last ones
+         * of the array get dropped (RejectNewest).
+         * 
+         * @param data Array of the elements to be pushed
+         * @param count Count of the elements in the array
+         * @return CounterType count of elements now stored from the array (only the newest BufferSize
+         * ones if more were given, only the first fitting ones for RejectNewest)
+         */
+        CounterType push(const T *data, CounterType count) {
+            CounterType freeSpace = leftCapacity();
+            if (count > freeSpace) {
+                _statistics.dropped(count - freeSpace);
+
+                if (Policy == RejectNewest) {
+                    count = freeSpace;
+                } else {
+                    if (count > BufferSize) {
+                        data += count - BufferSize;
+                        count = BufferSize;
+                    }
+                    _index.advanceTail(count - freeSpace);
+                }
+            }
+
+            Segment first, second;
+            writeSegments(first, second);
+            _copyIntoSegments(first, second, data, count);
+            _index.advanceHead(count);
+            _statistics.filled(size());
+
+            return count;
+        }
+
+        /**
+         * @brief Pop multiple elements at once
+         * 
+         * @param data Array the popped elements get written to
+         * @param count Maximum count of elements to be popped
+         * @return CounterType count of elements actually popped
+         */
+        CounterType pop(T *data, CounterType count) {
+            Segment first, second;
+            CounterType available = readSegments(first, second);
+            if (count > available) count = available;
+
+            _copyFromSegments(first, second, data, count);
+            _index.advanceTail(count);
+            return count;
+        }
+
+        /**
+         * @brief Get the (at most two) contiguous parts holding the stored elements, oldest first.
+         * Process the elements in place and release() them afterwards.
+         * 
+         * @param first Segment starting with the oldest element
+         * @param second Segment following the first one (length 0 if not wrapped)
+         * @return CounterType count of readable elements in total
+         */
+        CounterType readSegments(Segment &first, Segment &second) {
+            CounterType count = size();
+            CounterType tail = _index.tailSlot();
+            CounterType untilEnd = BufferSize - tail;
+
+            first.data = &_pool[tail];
+            first.length = count < untilEnd ? count : untilEnd;
+            second.data = _pool;
+            second.length = count - first.length;
+
+            return count;
+        }
+
+        /**
+         * @brief Get the (at most two) contiguous free parts of the buffer. Write the new elements
+         * directly into them (first segment first) and commit() them afterwards.
+         * 
+         * @param first Segment starting at the next free place
+         * @param second Segment following the first one (length 0 if not wrapped)
+         * @return CounterType count of free places in total
+         */
+        CounterType writeSegments(Segment &first, Segment &second) {
+            CounterType count = leftCapacity();
+            CounterType head = _index.headSlot();
+            CounterType untilEnd = BufferSize - head;
+
+            first.data = &_pool[head];
+            first.length = count < untilEnd ? count : untilEnd;
+            second.data = _pool;
+            second.length = count - first.length;
+
+            return count;
+        }
+
+        /**
+         * @brief Add elements written into the writeSegments() (or the reserve()d place) to the buffer
+         * 
+         * @param count Count of written elements, must not exceed the free places
+         */
+        void commit(CounterType count = 1) {
+            _index.advanceHead(count);
+            _statistics.filled(size());
+        }
+
+        /**
+         * @brief Remove the oldest elements, e.g. after processing them in the readSegments() or
+         * after peek()
+         * 
+         * @param count Count of elements to be removed, must not exceed the size
+         */
+        void release(CounterType count = 1) {
+            _index.advanceTail(count);
+        }
+
+        // ----------------------------------------- Zero-Copy Access
+
+        /**
+         * @brief Get the place of the next element to write it in place, then commit() it. If the
+         * buffer is full, the oldest element gets dropped (OverwriteOldest), same as push().
+         * 
+         * @return T* place for the next element, valid until the next modification of the buffer.
+         * nullptr if the buffer is full and rejects new data (RejectNewest).
+         */
+        T* reserve() {
+            if (full()) {
+                _statistics.dropped();
+                if (Policy == RejectNewest) return nullptr;
+                _index.advanceTail(1);
+            }
+            return &_pool[_index.headSlot()];
+        }
+
+        /**
+         * @brief Get the oldest element in place, without copying it. release() it afterwards.
+         * 
+         * @return T* the oldest element or nullptr if the buffer is empty
+         */
+        T* peek() {
+            if (empty()) return nullptr;
+            return &_pool[_index.tailSlot()];
+        }
+
+        /**
+         * @brief Get the oldest element in place, without copying it
+         * 
+         * @return const T* the oldest element or nullptr if the buffer is empty
+         */
+        const T* peek() const {
+            if (empty()) return nullptr;
+            return &_pool[_index.tailSlot()];
+        }
+
+        // ----------------------------------------- Statistics
+
+        /**
+         * @brief Returns the count of elements lost since the last resetStatistics(), either
+         * overwritten or rejected
+         * 
+         * @return uint32_t
+         */
+        uint32_t dropCount() const {
+            return _statistics.dropCount();
+        }
+
+        /**
+         * @brief Returns the highest count of elements stored at once since the last
+         * resetStatistics() (high-water mark). Use it to size the buffer.
+         * 
+         * @return CounterType
+         */
+        CounterType peakSize() const {
+            return _statistics.peakSize();
+        }
+
+        /**
+         * @brief Reset the drop count and the high-water mark. reset() keeps them on purpose.
+         * 
+         */
+        void resetStatistics() {
+            _statistics.reset();
+        }
+
     private:
         T _pool[BufferSize];
-        CounterType _head;
-        CounterType _tail;
-        bool _full;
+        steroido_intern::RingIndex<CounterType, BufferSize> _index;
+        steroido_intern::OverflowStatistics<CounterType> _statistics;
+
+        static void _copyIntoSegments(const Segment &first, const Segment &second, const T *data, CounterType count) {
+            if (count <= first.length) {
+                memCpy<T>(first.data, data, count);
+            } else {
+                memCpy<T>(first.data, data, first.length);
+                memCpy<T>(second.data, data + first.length, count - first.length);
+            }
+        }
+
+        static void _copyFromSegments(const Segment &first, const Segment &second, T *data, CounterType count) {
+            if (count <= first.length) {
+                memCpy<T>(data, first.data, count);
+            } else {
+                memCpy<T>(data, first.data, first.length);
+                memCpy<T>(data + first.length, second.data, count - first.length);
+            }
+        }
 };
 
 #endif
@@ -0,0 +1,33 @@
+#ifndef CRC16_H
+#define CRC16_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace steroido_intern {
+    // CRC of every nibble value, for the polynomial 0x1021
+    static const uint16_t _crc16NibbleTable[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    };
+};
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polynomial 0x1021, start value 0xFFFF), same as
+ * binascii.crc_hqx(data, 0xFFFF) in Python. Uses a table of 16 entries, a compromise between
+ * speed and flash usage.
+ *
+ * @param data
+ * @param length Count of bytes
+ * @param crc CRC of the preceding data, to calculate it in parts
+ * @return uint16_t
+ */
+inline uint16_t crc16(const uint8_t *data, size_t length, uint16_t crc = 0xFFFF) {
+    for (size_t i = 0; i < length; i++) {
+        crc = (crc << 4) ^ steroido_intern::_crc16NibbleTable[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (crc << 4) ^ steroido_intern::_crc16NibbleTable[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    return crc;
+}
+
+#endif // CRC16_H
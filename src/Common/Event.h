@@ -0,0 +1,323 @@
+#ifndef EVENT_H
+#define EVENT_H
+
+#include <stddef.h>
+#include "NonCopyable.h"
+
+template<typename... Args>
+class Event;
+
+/**
+ * @brief A Listener which can be connected to an Event. The Listener is an intrusive list node,
+ * so connecting/disconnecting never allocates memory and is O(1). Derive from this class and
+ * implement onEvent() or use EventFunctionListener/EventMethodListener.
+ *
+ * @tparam Args The Arguments of the Event
+ */
+template<typename... Args>
+class EventListener : private NonCopyable<EventListener<Args...>> {
+    public:
+        EventListener() : _event(nullptr), _prev(nullptr), _next(nullptr) {}
+
+        /**
+         * @brief Destroy the Event Listener. Disconnects it from its Event, if connected.
+         *
+         */
+        virtual ~EventListener() {
+            disconnect();
+        }
+
+        /**
+         * @brief Called on every emit of the connected Event
+         *
+         * @param args
+         */
+        virtual void onEvent(Args... args) = 0;
+
+        /**
+         * @brief Disconnect the Listener from its Event. Safe to be called while the Event is emitting,
+         * even from within onEvent().
+         *
+         */
+        void disconnect() {
+            if (_event) {
+                _event->disconnect(*this);
+            }
+        }
+
+        /**
+         * @brief Check if the Listener is currently connected to an Event
+         *
+         * @return true if connected
+         * @return false if not connected
+         */
+        bool connected() const {
+            return _event != nullptr;
+        }
+
+    private:
+        friend class Event<Args...>;
+
+        Event<Args...> *_event;
+        EventListener<Args...> *_prev;
+        EventListener<Args...> *_next;
+};
+
+/**
+ * @brief Event Listener calling a plain function
+ *
+ * @tparam Args The Arguments of the Event
+ */
+template<typename... Args>
+class EventFunctionListener : public EventListener<Args...> {
+    public:
+        /**
+         * @brief Construct a new Event Function Listener
+         *
+         * @param func Function to be called on every emit
+         */
+        EventFunctionListener(void(*func)(Args...)) : _func(func) {}
+
+        void onEvent(Args... args) {
+            (*_func)(args...);
+        }
+
+    private:
+        void (*_func)(Args...);
+};
+
+/**
+ * @brief Event Listener calling a method of an Instance of a Class
+ *
+ * @tparam T The Class of the Instance
+ * @tparam Args The Arguments of the Event
+ */
+template<typename T, typename... Args>
+class EventMethodListener : public EventListener<Args...> {
+    public:
+        /**
+         * @brief Construct a new Event Method Listener
+         *
+         * @param obj The Instance of the Object the Method should be called on
+         * @param method The Method (-pointer) which should be called on every emit
+         */
+        EventMethodListener(T *obj, void(T::*method)(Args...)) : _obj(obj), _method(method) {}
+
+        /**
+         * @brief Construct a new Event Method Listener
+         *
+         * @param obj The Instance of the Object the Method should be called on
+         * @param method The Method (-pointer) which should be called on every emit
+         */
+        EventMethodListener(T &obj, void(T::*method)(Args...)) : _obj(&obj), _method(method) {}
+
+        void onEvent(Args... args) {
+            (_obj->*_method)(args...);
+        }
+
+    private:
+        T *_obj;
+        void (T::*_method)(Args...);
+};
+
+/**
+ * @brief A multicast Event. Any number of Listeners can be connected to it, each emit() calls all
+ * of them in the order they got connected. The Listeners are linked intrusively, so the Event
+ * itself never allocates memory.
+ *
+ * @tparam Args The Arguments given to the Listeners on emit
+ */
+template<typename... Args>
+class Event : private NonCopyable<Event<Args...>> {
+    public:
+        /**
+         * @brief Construct a new Event without any Listeners
+         *
+         */
+        Event() : _first(nullptr), _last(nullptr), _cursors(nullptr), _listenerCount(0) {}
+
+        /**
+         * @brief Destroy the Event. All still connected Listeners get disconnected.
+         *
+         */
+        ~Event() {
+            disconnectAll();
+        }
+
+        /**
+         * @brief Connect a Listener to the Event. If the Listener is connected to another Event, it will
+         * be disconnected from it first. Listeners connected during an emit will be called in the same emit.
+         *
+         * @param listener
+         */
+        void connect(EventListener<Args...> &listener) {
+            if (listener._event == this) return; // -> already connected
+            listener.disconnect();
+
+            listener._event = this;
+            listener._prev = _last;
+            listener._next = nullptr;
+
+            if (_last) {
+                _last->_next = &listener;
+            } else {
+                _first = &listener;
+            }
+            _last = &listener;
+
+            // Running emits which already reached the end continue with the new Listener
+            for (_EmitCursor *cursor = _cursors; cursor; cursor = cursor->outer) {
+                if (!cursor->next) {
+                    cursor->next = &listener;
+                }
+            }
+
+            ++_listenerCount;
+        }
+
+        /**
+         * @brief Disconnect a Listener from the Event. Safe to be called during emit.
+         *
+         * @param listener
+         * @return true if the Listener got disconnected
+         * @return false if the Listener has not been connected to this Event
+         */
+        bool disconnect(EventListener<Args...> &listener) {
+            if (listener._event != this) return false;
+
+            // Running emits must not step onto the removed Listener
+            for (_EmitCursor *cursor = _cursors; cursor; cursor = cursor->outer) {
+                if (cursor->next == &listener) {
+                    cursor->next = listener._next;
+                }
+                if (cursor->current == &listener) {
+                    cursor->current = nullptr;
+                }
+            }
+
+            if (listener._prev) {
+                listener._prev->_next = listener._next;
+            } else {
+                _first = listener._next;
+            }
+
+            if (listener._next) {
+                listener._next->_prev = listener._prev;
+            } else {
+                _last = listener._prev;
+            }
+
+            listener._event = nullptr;
+            listener._prev = nullptr;
+            listener._next = nullptr;
+
+            --_listenerCount;
+            return true;
+        }
+
+        /**
+         * @brief Disconnect all Listeners
+         *
+         */
+        void disconnectAll() {
+            while (_first) {
+                disconnect(*_first);
+            }
+        }
+
+        /**
+         * @brief Call all connected Listeners with the given Arguments
+         *
+         * @param args
+         */
+        void emit(Args... args) {
+            _EmitCursor cursor(_first, _cursors);
+            _cursors = &cursor;
+
+            while (cursor.next) {
+                EventListener<Args...> *current = cursor.next;
+                cursor.next = current->_next;
+                current->onEvent(args...);
+            }
+
+            _cursors = cursor.outer;
+        }
+
+        /**
+         * @brief Shorthand for emit(args)
+         *
+         * @param args
+         */
+        void operator()(Args... args) {
+            emit(args...);
+        }
+
+        /**
+         * @brief Emit a whole batch of values at once. Each Listener gets called for all values before
+         * the next Listener is called, so the Listener list is walked only once. Only available for
+         * Events with exactly one Argument.
+         *
+         * @tparam V Type of the values, has to be convertible to the Argument of the Event
+         * @param values Array of the values to be emitted
+         * @param count Count of values in the array
+         */
+        template<typename V>
+        void emitBatch(const V *values, size_t count) {
+            static_assert(sizeof...(Args) == 1, "emitBatch() is only available for Events with one Argument");
+
+            _EmitCursor cursor(_first, _cursors);
+            _cursors = &cursor;
+
+            while (cursor.next) {
+                cursor.current = cursor.next;
+                cursor.next = cursor.current->_next;
+
+                // Stop as soon as the Listener got disconnected (or destroyed)
+                for (size_t i = 0; i < count && cursor.current; ++i) {
+                    cursor.current->onEvent(values[i]);
+                }
+            }
+
+            _cursors = cursor.outer;
+        }
+
+        /**
+         * @brief Returns the count of connected Listeners
+         *
+         * @return size_t
+         */
+        size_t listenerCount() const {
+            return _listenerCount;
+        }
+
+        /**
+         * @brief Check if no Listener is connected
+         *
+         * @return true if no Listener is connected
+         * @return false if at least one Listener is connected
+         */
+        bool empty() const {
+            return _first == nullptr;
+        }
+
+    private:
+        /**
+         * @brief Position of a running emit. Nested emits are chained, so disconnect() can fix all of them.
+         *
+         */
+        struct _EmitCursor {
+            _EmitCursor(EventListener<Args...> *_next, _EmitCursor *_outer)
+                : current(nullptr), next(_next), outer(_outer) {}
+
+            EventListener<Args...> *current;
+            EventListener<Args...> *next;
+            _EmitCursor *outer;
+        };
+
+        EventListener<Args...> *_first;
+        EventListener<Args...> *_last;
+        _EmitCursor *_cursors;
+        size_t _listenerCount;
+};
+
+#endif // EVENT_H
@@ -0,0 +1,211 @@
+#ifndef FAST_MAP_H
+#define FAST_MAP_H
+
+#include <stdint.h>
+
+/*
+    Faster alternatives to mapC for hot paths (e.g. every analog channel in every loop). The division
+    of mapC is done once when the mapper is created, each call is only a multiply and an add.
+*/
+
+/**
+ * @brief Maps a value from a scale to a new one with a precomputed scale and offset. Values outside
+ * of the input range are extrapolated, like mapC does.
+ *
+ * @tparam T Datatype of the values, should be a floating point type (use FixedLinearMap for integers)
+ */
+template<typename T = float>
+class LinearMap {
+    public:
+        /**
+         * @brief Create a mapper for the given ranges
+         *
+         * @param in_min
+         * @param in_max must differ from in_min
+         * @param out_min
+         * @param out_max
+         */
+        LinearMap(T in_min, T in_max, T out_min, T out_max) :
+            _scale((out_max - out_min) / (in_max - in_min)),
+            _offset(out_min - in_min * _scale) {}
+
+        /**
+         * @brief Map a value
+         *
+         * @param x value to map
+         * @return T mapped value
+         */
+        T map(T x) const {
+            return x * _scale + _offset;
+        }
+
+        T operator()(T x) const {
+            return map(x);
+        }
+
+        T scale() const {
+            return _scale;
+        }
+
+        T offset() const {
+            return _offset;
+        }
+
+    private:
+        T _scale;
+        T _offset;
+};
+
+
+/**
+ * @brief Maps integers from a scale to a new one with a precomputed fixed-point scale (Q16.16 by
+ * default), so each call is an integer multiply and a shift. The result is rounded to the nearest
+ * value (mapC truncates). Values outside of the input range are extrapolated.
+ *
+ * @tparam T Datatype of the values
+ * @tparam WideType Type for the product of value and scale. int64_t is always safe, int32_t is much
+ * faster on 8 bit controllers and fits if |in_max - in_min| * |scale| < 2^(31 - FractionBits)
+ * @tparam FractionBits Number of fractional bits of the scale
+ */
+template<typename T = int32_t, typename WideType = int64_t, uint8_t FractionBits = 16>
+class FixedLinearMap {
+    static_assert(FractionBits > 0 && FractionBits < sizeof(WideType) * 8 - 1, "FractionBits do not fit into WideType");
+
+    public:
+        /**
+         * @brief Create a mapper for the given ranges
+         *
+         * @param in_min
+         * @param in_max must differ from in_min
+         * @param out_min
+         * @param out_max
+         */
+        FixedLinearMap(T in_min, T in_max, T out_min, T out_max) :
+            _inMin(in_min), _outMin(out_min),
+            _scale(static_cast<WideType>(static_cast<int64_t>(out_max - out_min) * (static_cast<int64_t>(1) << FractionBits) / (in_max - in_min))) {}
+
+        /**
+         * @brief Map a value
+         *
+         * @param x value to map
+         * @return T mapped value
+         */
+        T map(T x) const {
+            WideType product = static_cast<WideType>(x - _inMin) * _scale + (static_cast<WideType>(1) << (FractionBits - 1));
+            return static_cast<T>(product >> FractionBits) + _outMin;
+        }
+
+        T operator()(T x) const {
+            return map(x);
+        }
+
+    private:
+        T _inMin;
+        T _outMin;
+        WideType _scale;
+};
+
+
+/**
+ * @brief Map with ranges known at compile time. The scale is a constant, so the compiler replaces the
+ * division (float: by a multiplication, integers: by a multiply-shift).
+ *
+ * @tparam InMin
+ * @tparam InMax must differ from InMin
+ * @tparam OutMin
+ * @tparam OutMax
+ */
+template<long InMin, long InMax, long OutMin, long OutMax>
+struct StaticMap {
+    static_assert(InMin != InMax, "The input range of StaticMap must not be empty");
+
+    /**
+     * @brief Map a value, same result as mapC
+     *
+     * @tparam T Datatype of the value
+     * @param x value to map
+     * @return T mapped value
+     */
+    template<typename T>
+    static constexpr T map(T x) {
+        return T(1) / T(2) != T(0)
+            ? (x - T(InMin)) * (T(OutMax - OutMin) / T(InMax - InMin)) + T(OutMin)
+            : (x - T(InMin)) * T(OutMax - OutMin) / T(InMax - InMin) + T(OutMin);
+    }
+};
+
+
+/**
+ * @brief Maps values along a curve of N points (e.g. a sensor calibration), linear in between. The
+ * scale of each segment is precomputed, a call is a binary search and one Mapper call. Values outside
+ * of the curve are clamped to its first/last point.
+ *
+ * @tparam T Datatype of the values
+ * @tparam N Count of points
+ * @tparam Mapper Mapper used for the segments, LinearMap for floats or FixedLinearMap for integers
+ */
+template<typename T, unsigned int N, class Mapper = LinearMap<T>>
+class PiecewiseLinearMap {
+    static_assert(N >= 2, "PiecewiseLinearMap needs at least two points");
+
+    public:
+        /**
+         * @brief Create a mapper for the given curve
+         *
+         * @param in_points Input values of the points, strictly ascending
+         * @param out_points Output values of the points
+         */
+        PiecewiseLinearMap(const T (&in_points)[N], const T (&out_points)[N]) :
+            PiecewiseLinearMap(in_points, out_points, _Indices<N - 1>()) {}
+
+        /**
+         * @brief Map a value
+         *
+         * @param x value to map
+         * @return T mapped value
+         */
+        T map(T x) const {
+            if (x <= _inPoints[0]) return _outFirst;
+            if (x >= _inPoints[N - 1]) return _outLast;
+
+            // Find the segment with _inPoints[low] <= x < _inPoints[low + 1]
+            unsigned int low = 0;
+            unsigned int high = N - 1;
+            while (high - low > 1) {
+                unsigned int middle = (low + high) / 2;
+                if (x < _inPoints[middle]) {
+                    high = middle;
+                } else {
+                    low = middle;
+                }
+            }
+
+            return _segments[low](x);
+        }
+
+        T operator()(T x) const {
+            return map(x);
+        }
+
+    private:
+        template<unsigned int... I> struct _IndexList {};
+        template<unsigned int Count, unsigned int... I> struct _Indices : _Indices<Count - 1, Count - 1, I...> {};
+        template<unsigned int... I> struct _Indices<0, I...> : _IndexList<I...> {};
+
+        // The mappers have no default constructor, so they are created with a pack of indices
+        template<unsigned int... I>
+        PiecewiseLinearMap(const T (&in_points)[N], const T (&out_points)[N], _IndexList<I...>) :
+            _segments{Mapper(in_points[I], in_points[I + 1], out_points[I], out_points[I + 1])...},
+            _outFirst(out_points[0]), _outLast(out_points[N - 1]) {
+            for (unsigned int i = 0; i < N; i++) {
+                _inPoints[i] = in_points[i];
+            }
+        }
+
+        Mapper _segments[N - 1];
+        T _inPoints[N];
+        T _outFirst;
+        T _outLast;
+};
+
+#endif // FAST_MAP_H
@@ -0,0 +1,48 @@
+#ifndef OVERFLOW_POLICY_H
+#define OVERFLOW_POLICY_H
+
+#include <stdint.h>
+
+/**
+ * @brief What a ring buffer does with new data if it is full
+ *
+ */
+enum OverflowPolicy : uint8_t {
+    OverwriteOldest = 0,    // Drop the oldest element to make place for the new one
+    RejectNewest            // Keep the stored elements, the new one gets dropped
+};
+
+namespace steroido_intern {
+    /**
+     * @brief Counts the elements lost to overflows and the highest fill level of a ring buffer
+     *
+     * @tparam CounterType The Type the buffer counts its elements with
+     */
+    template<typename CounterType>
+    class OverflowStatistics {
+        public:
+            OverflowStatistics() : _dropCount(0), _peakSize(0) {}
+
+            void dropped(uint32_t count = 1) {
+                _dropCount += count;
+            }
+
+            void filled(CounterType size) {
+                if (size > _peakSize) _peakSize = size;
+            }
+
+            uint32_t dropCount() const { return _dropCount; }
+            CounterType peakSize() const { return _peakSize; }
+
+            void reset() {
+                _dropCount = 0;
+                _peakSize = 0;
+            }
+
+        private:
+            uint32_t _dropCount;
+            CounterType _peakSize;
+    };
+};
+
+#endif // OVERFLOW_POLICY_H
@@ -0,0 +1,256 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "NonCopyable.h"
+
+#ifdef NATIVE
+    #include <mutex>
+#endif
+
+/*
+    Fixed-Block Pool Allocator. Define STEROIDO_POOL_ALLOCATOR_ENABLED (in code before including
+    Steroido or with build_flags) to route Callback targets, the Scheduler element storage and
+    the bundled vector through a global pool instead of the general purpose heap.
+*/
+
+#ifndef STEROIDO_POOL_BLOCK_SIZE
+    // Fits a Callback MethodCaller (vtable, object pointer, method pointer) on all platforms
+    #define STEROIDO_POOL_BLOCK_SIZE (4 * sizeof(void*))
+#endif
+
+#ifndef STEROIDO_POOL_BLOCK_COUNT
+    #define STEROIDO_POOL_BLOCK_COUNT 16
+#endif
+
+/**
+ * @brief Lock for a single threaded PoolAllocator (default), does nothing
+ *
+ */
+class PoolNoLock {
+    public:
+        void lock() {}
+        void unlock() {}
+};
+
+#ifdef NATIVE
+/**
+ * @brief Lock for a PoolAllocator shared between threads (native only)
+ *
+ */
+class PoolMutexLock {
+    public:
+        void lock() { _mutex.lock(); }
+        void unlock() { _mutex.unlock(); }
+
+    private:
+        std::mutex _mutex;
+};
+#endif
+
+/**
+ * @brief Allocator handing out blocks of a fixed size from static storage. Allocating and freeing
+ * is O(1) and can not fragment the memory. Blocks never touched before are handed out in order, so
+ * a new pool does not need to be initialized.
+ *
+ * @tparam BlockSize Size of a single block in bytes
+ * @tparam BlockCount Count of blocks in the pool
+ * @tparam Lock PoolNoLock or PoolMutexLock (native only)
+ */
+template<size_t BlockSize, size_t BlockCount, class Lock = PoolNoLock>
+class PoolAllocator : private NonCopyable<PoolAllocator<BlockSize, BlockCount, Lock>> {
+    public:
+        PoolAllocator() : _freeList(nullptr), _untouched(0), _used(0), _peak(0) {}
+
+        /**
+         * @brief Allocate a single block
+         *
+         * @return void* the block or nullptr if the pool is exhausted
+         */
+        void* allocate() {
+            _lock.lock();
+
+            _Block *block = _freeList;
+            if (block) {
+                _freeList = block->next;
+            } else if (_untouched < BlockCount) {
+                block = &_blocks[_untouched++];
+            }
+
+            if (block) {
+                if (++_used > _peak) _peak = _used;
+            }
+
+            _lock.unlock();
+            return block;
+        }
+
+        /**
+         * @brief Give a block back to the pool. Only give back blocks allocated from this pool!
+         *
+         * @param ptr
+         */
+        void deallocate(void* ptr) {
+            if (!ptr) return;
+
+            _Block *block = static_cast<_Block*>(ptr);
+
+            _lock.lock();
+            block->next = _freeList;
+            _freeList = block;
+            --_used;
+            _lock.unlock();
+        }
+
+        /**
+         * @brief Check if the given memory is part of this pool
+         *
+         * @param ptr
+         * @return true if the memory belongs to this pool
+         * @return false if the memory does not belong to this pool
+         */
+        bool owns(const void* ptr) const {
+            const uint8_t *bytePtr = static_cast<const uint8_t*>(ptr);
+            const uint8_t *begin = reinterpret_cast<const uint8_t*>(_blocks);
+
+            return bytePtr >= begin && bytePtr < begin + sizeof(_blocks);
+        }
+
+        /**
+         * @brief Returns the size of a single block
+         *
+         * @return size_t
+         */
+        static constexpr size_t blockSize() { return BlockSize; }
+
+        /**
+         * @brief Returns the count of blocks in the pool
+         *
+         * @return size_t
+         */
+        static constexpr size_t blockCount() { return BlockCount; }
+
+        /**
+         * @brief Returns the count of blocks currently in use
+         *
+         * @return size_t
+         */
+        size_t used() const { return _used; }
+
+        /**
+         * @brief Returns the highest count of blocks used at once. Use it to size the pool.
+         *
+         * @return size_t
+         */
+        size_t peak() const { return _peak; }
+
+        /**
+         * @brief Returns the count of blocks which can still be allocated
+         *
+         * @return size_t
+         */
+        size_t available() const { return BlockCount - _used; }
+
+    private:
+        // Free blocks store the link to the next free block in themselves
+        union _Block {
+            _Block *next;
+            uint8_t data[BlockSize];
+            long long alignLongLong;
+            double alignDouble;
+        };
+
+        _Block _blocks[BlockCount];
+        _Block *_freeList;
+        size_t _untouched;
+        size_t _used;
+        size_t _peak;
+        Lock _lock;
+};
+
+
+#if defined(NATIVE) && defined(STEROIDO_POOL_THREAD_SAFE)
+    typedef PoolAllocator<STEROIDO_POOL_BLOCK_SIZE, STEROIDO_POOL_BLOCK_COUNT, PoolMutexLock> SteroidoPool;
+#else
+    typedef PoolAllocator<STEROIDO_POOL_BLOCK_SIZE, STEROIDO_POOL_BLOCK_COUNT> SteroidoPool;
+#endif
+
+namespace steroido_intern {
+    /**
+     * @brief The global pool used by Steroido. Constructed on first use, so it is safe to allocate
+     * from global constructors.
+     *
+     * @return SteroidoPool&
+     */
+    inline SteroidoPool& globalPool() {
+        static SteroidoPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Allocate memory. Uses the global pool if enabled and the size fits into a block, the heap
+     * otherwise (or if the pool is exhausted).
+     *
+     * @param size in bytes
+     * @return void*
+     */
+    inline void* allocate(size_t size) {
+        #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+            if (size <= SteroidoPool::blockSize()) {
+                void *block = globalPool().allocate();
+                if (block) return block;
+            }
+        #endif
+
+        return ::operator new(size);
+    }
+
+    /**
+     * @brief Free memory allocated with allocate()
+     *
+     * @param ptr
+     */
+    inline void deallocate(void* ptr) {
+        #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+            if (globalPool().owns(ptr)) {
+                globalPool().deallocate(ptr);
+                return;
+            }
+        #endif
+
+        ::operator delete(ptr);
+    }
+
+    /**
+     * @brief Minimal STL Allocator using allocate()/deallocate(), for the STL containers
+     *
+     * @tparam T
+     */
+    template<typename T>
+    class PoolStlAllocator {
+        public:
+            typedef T value_type;
+
+            PoolStlAllocator() {}
+
+            template<typename U>
+            PoolStlAllocator(const PoolStlAllocator<U> &) {}
+
+            T* allocate(size_t count) {
+                return static_cast<T*>(steroido_intern::allocate(count * sizeof(T)));
+            }
+
+            void deallocate(T* ptr, size_t) {
+                steroido_intern::deallocate(ptr);
+            }
+
+            template<typename U>
+            bool operator==(const PoolStlAllocator<U> &) const { return true; }
+
+            template<typename U>
+            bool operator!=(const PoolStlAllocator<U> &) const { return false; }
+    };
+};
+
+#endif // POOL_ALLOCATOR_H
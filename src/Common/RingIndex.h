@@ -0,0 +1,211 @@
+#ifndef RING_INDEX_H
+#define RING_INDEX_H
+
+#include <stddef.h>
+
+/**
+ * @brief A contiguous part of the pool of a ring buffer, e.g. to process or copy the contained
+ * elements in place
+ *
+ * @tparam T The Type of the elements
+ * @tparam CounterType The Type the ring buffer counts its elements with
+ */
+template<typename T, typename CounterType>
+struct BufferSegment {
+    T *data;
+    CounterType length;
+};
+
+namespace steroido_intern {
+    /**
+     * @brief Head/Tail bookkeeping of a ring buffer. The generic version keeps both indices inside
+     * [0, BufferSize) and wraps them with a compare instead of a modulo. If BufferSize is a power of
+     * two, the specialization below is selected at compile time.
+     *
+     * Slots are the physical indices in the pool of the ring buffer. The head slot is the one the next
+     * pushed element is written to, the tail slot holds the oldest element.
+     *
+     * @tparam CounterType Unsigned type able to hold BufferSize
+     * @tparam BufferSize The Size of the buffer (element count)
+     * @tparam PowerOfTwo Selects the specialization, leave the default!
+     */
+    template<typename CounterType, size_t BufferSize, bool PowerOfTwo = ((BufferSize & (BufferSize - 1)) == 0)>
+    class RingIndex {
+        static_assert(BufferSize > 0, "BufferSize must be at least 1");
+        static_assert((CounterType)(-1) > 0, "CounterType must be unsigned");
+        static_assert((CounterType)BufferSize == BufferSize, "CounterType is too small for the BufferSize");
+
+        public:
+            RingIndex() : _head(0), _tail(0), _full(false) {}
+
+            void reset() {
+                _head = 0;
+                _tail = 0;
+                _full = false;
+            }
+
+            bool empty() const { return (_head == _tail) && !_full; }
+            bool full() const { return _full; }
+
+            CounterType size() const {
+                if (_full) return BufferSize;
+                if (_head < _tail) return BufferSize + _head - _tail;
+                return _head - _tail;
+            }
+
+            CounterType headSlot() const { return _head; }
+            CounterType tailSlot() const { return _tail; }
+
+            /**
+             * @brief Slot of the element the given distance away from the tail (0 == oldest)
+             *
+             * @param index
+             * @return CounterType
+             */
+            CounterType slotFromTail(CounterType index) const {
+                if (index >= BufferSize) index %= BufferSize;
+                return _add(_tail, index);
+            }
+
+            /**
+             * @brief Slot of the element the given distance away from the head (0 == newest)
+             *
+             * @param index
+             * @return CounterType
+             */
+            CounterType slotFromHead(CounterType index) const {
+                if (index >= BufferSize) index %= BufferSize;
+                return _subtract(_head, (size_t)index + 1);
+            }
+
+            static CounterType nextSlot(CounterType slot) {
+                if (++slot == BufferSize) slot = 0;
+                return slot;
+            }
+
+            static CounterType previousSlot(CounterType slot) {
+                if (slot == 0) slot = BufferSize;
+                return slot - 1;
+            }
+
+            // The following amounts must not exceed BufferSize (and the size/left capacity)
+
+            /**
+             * @brief Add elements written at the head slot(s)
+             *
+             * @param amount
+             */
+            void advanceHead(CounterType amount) {
+                if (!amount) return;
+                _head = _add(_head, amount);
+                _full = (_head == _tail);
+            }
+
+            /**
+             * @brief Remove the oldest elements
+             *
+             * @param amount
+             */
+            void advanceTail(CounterType amount) {
+                if (!amount) return;
+                _tail = _add(_tail, amount);
+                _full = false;
+            }
+
+            /**
+             * @brief Remove the newest elements
+             *
+             * @param amount
+             */
+            void retreatHead(CounterType amount) {
+                if (!amount) return;
+                _head = _subtract(_head, amount);
+                _full = false;
+            }
+
+            /**
+             * @brief Add elements in front of the oldest element
+             *
+             * @param amount
+             */
+            void retreatTail(CounterType amount) {
+                if (!amount) return;
+                _tail = _subtract(_tail, amount);
+                _full = (_head == _tail);
+            }
+
+        private:
+            CounterType _head;
+            CounterType _tail;
+            bool _full;
+
+            // Single steps are the common case, they wrap with a single compare
+            static CounterType _add(CounterType slot, size_t amount) {
+                if (amount == 1) return nextSlot(slot);
+
+                size_t newSlot = slot + amount;
+                if (newSlot >= BufferSize) newSlot -= BufferSize;
+                return newSlot;
+            }
+
+            static CounterType _subtract(CounterType slot, size_t amount) {
+                if (amount == 1) return previousSlot(slot);
+
+                if (slot >= amount) return slot - amount;
+                return BufferSize - (amount - slot);
+            }
+    };
+
+    /**
+     * @brief RingIndex for a power of two BufferSize. Head and tail are free running counters which
+     * are only masked when accessing a slot, so no compares, no modulo and no full flag are needed.
+     *
+     * @tparam CounterType Unsigned type able to hold BufferSize
+     * @tparam BufferSize The Size of the buffer (element count)
+     */
+    template<typename CounterType, size_t BufferSize>
+    class RingIndex<CounterType, BufferSize, true> {
+        static_assert(BufferSize > 0, "BufferSize must be at least 1");
+        static_assert((CounterType)(-1) > 0, "CounterType must be unsigned");
+        static_assert((CounterType)BufferSize == BufferSize, "CounterType is too small for the BufferSize");
+
+        public:
+            RingIndex() : _head(0), _tail(0) {}
+
+            void reset() {
+                _head = 0;
+                _tail = 0;
+            }
+
+            bool empty() const { return _head == _tail; }
+            bool full() const { return size() == BufferSize; }
+            CounterType size() const { return (CounterType)(_head - _tail); }
+
+            CounterType headSlot() const { return _head & _mask; }
+            CounterType tailSlot() const { return _tail & _mask; }
+
+            CounterType slotFromTail(CounterType index) const {
+                return (CounterType)(_tail + index) & _mask;
+            }
+
+            CounterType slotFromHead(CounterType index) const {
+                return (CounterType)(_head - index - 1) & _mask;
+            }
+
+            static CounterType nextSlot(CounterType slot) { return (CounterType)(slot + 1) & _mask; }
+            static CounterType previousSlot(CounterType slot) { return (CounterType)(slot - 1) & _mask; }
+
+            void advanceHead(CounterType amount) { _head += amount; }
+            void advanceTail(CounterType amount) { _tail += amount; }
+            void retreatHead(CounterType amount) { _head -= amount; }
+            void retreatTail(CounterType amount) { _tail -= amount; }
+
+        private:
+            static const CounterType _mask = BufferSize - 1;
+
+            CounterType _head;
+            CounterType _tail;
+    };
+};
+
+#endif // RING_INDEX_H
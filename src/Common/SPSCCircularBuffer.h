@@ -0,0 +1,363 @@
+#ifndef SPSC_CIRCULAR_BUFFER_H
+#define SPSC_CIRCULAR_BUFFER_H
+
+#include <stdint.h>
+#include "NonCopyable.h"
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#else
+    #include <atomic>
+#endif
+
+#ifdef NATIVE
+    #include <chrono>
+    #include <thread>
+#endif
+
+namespace steroido_intern {
+    #if defined(__AVR__)
+    /**
+     * @brief Index (or counter) shared between an interrupt and the main loop. Single byte indices
+     * are read and written atomically by the AVR anyway, wider ones are accessed with interrupts
+     * disabled.
+     *
+     * @tparam CounterType
+     */
+    template<typename CounterType>
+    class SPSCIndex {
+        public:
+            SPSCIndex() : _value(0) {}
+
+            /**
+             * @brief Load the index written by the other side
+             *
+             * @return CounterType
+             */
+            CounterType load() const {
+                CounterType value;
+
+                if (sizeof(CounterType) == 1) {
+                    value = _value;
+                } else {
+                    uint8_t oldSREG = SREG;
+                    cli();
+                    value = _value;
+                    SREG = oldSREG;
+                }
+
+                // Element accesses must not be moved in front of the index load
+                asm volatile("" ::: "memory");
+                return value;
+            }
+
+            /**
+             * @brief Load the own index (no synchronization needed)
+             *
+             * @return CounterType
+             */
+            CounterType loadOwn() const {
+                return _value;
+            }
+
+            /**
+             * @brief Publish a new index to the other side
+             *
+             * @param value
+             */
+            void store(CounterType value) {
+                // Element accesses must be done before the index is published
+                asm volatile("" ::: "memory");
+
+                if (sizeof(CounterType) == 1) {
+                    _value = value;
+                } else {
+                    uint8_t oldSREG = SREG;
+                    cli();
+                    _value = value;
+                    SREG = oldSREG;
+                }
+            }
+
+        private:
+            volatile CounterType _value;
+    };
+    #else
+    /**
+     * @brief Index (or counter) shared between two threads (or an interrupt and the main loop) using
+     * acquire/release ordering, so the element is always written before the other side sees the new
+     * index.
+     *
+     * @tparam CounterType
+     */
+    template<typename CounterType>
+    class SPSCIndex {
+        public:
+            SPSCIndex() : _value(0) {}
+
+            /**
+             * @brief Load the index written by the other side
+             *
+             * @return CounterType
+             */
+            CounterType load() const {
+                return _value.load(std::memory_order_acquire);
+            }
+
+            /**
+             * @brief Load the own index (no synchronization needed)
+             *
+             * @return CounterType
+             */
+            CounterType loadOwn() const {
+                return _value.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Publish a new index to the other side
+             *
+             * @param value
+             */
+            void store(CounterType value) {
+                _value.store(value, std::memory_order_release);
+            }
+
+        private:
+            #ifdef NATIVE
+                // Keep producer and consumer index in different cache lines
+                alignas(64) std::atomic<CounterType> _value;
+            #else
+                std::atomic<CounterType> _value;
+            #endif
+    };
+    #endif
+};
+
+/**
+ * @brief Lock-free single-producer/single-consumer buffer. One side (e.g. an interrupt handler or a
+ * thread) may only push, the other one (e.g. the main loop) may only pop/peek. Contrary to
+ * CircularBuffer, a full buffer rejects new data (RejectNewest), as the producer must never touch
+ * the tail. On native, the producer may also wait for space with a timeout.
+ *
+ * @tparam T The Type of the saved object/datatype
+ * @tparam BufferSize The Size of the buffer (element count)
+ * @tparam CounterType The Type the buffer will count the elements
+ * @note CounterType must be unsigned and able to hold BufferSize. On AVR, a uint8_t CounterType
+ * avoids disabling interrupts for accessing the indices.
+ */
+template<typename T, uint16_t BufferSize, typename CounterType = uint16_t>
+class SPSCCircularBuffer : private NonCopyable<SPSCCircularBuffer<T, BufferSize, CounterType>> {
+    static_assert(BufferSize > 0, "BufferSize must be at least 1");
+    static_assert((CounterType)(-1) > 0, "CounterType must be unsigned");
+    static_assert((CounterType)BufferSize == BufferSize, "CounterType is too small for the BufferSize");
+
+    public:
+        /**
+         * @brief Construct a new SPSC Circular Buffer
+         *
+         */
+        SPSCCircularBuffer() {}
+
+        // ----------------------------------------- Producer
+
+        /**
+         * @brief Push the data to the buffer. Producer side only!
+         *
+         * @param data Data to be pushed to the buffer
+         * @return true if the data got pushed
+         * @return false if the buffer is full, the data got dropped
+         */
+        bool push(const T &data) {
+            if (_tryPush(data)) return true;
+
+            _dropCount.store(_dropCount.loadOwn() + 1);
+            return false;
+        }
+
+        #ifdef NATIVE
+        /**
+         * @brief Push the data to the buffer, waiting for the consumer if the buffer is full.
+         * Producer side only, native only (the producer has to run in its own thread)!
+         *
+         * @param data Data to be pushed to the buffer
+         * @param timeoutUs Maximum time to wait for a free place in microseconds
+         * @return true if the data got pushed
+         * @return false if the buffer stayed full until the timeout, the data got dropped
+         */
+        bool push(const T &data, uint32_t timeoutUs) {
+            std::chrono::steady_clock::time_point deadline =
+                std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+
+            while (!_tryPush(data)) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    _dropCount.store(_dropCount.loadOwn() + 1);
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+
+            return true;
+        }
+        #endif
+
+        /**
+         * @brief Check if the buffer is full. Exact for the producer, a snapshot for the consumer.
+         *
+         * @return true if the buffer is full
+         * @return false if one or more places are empty
+         */
+        bool full() const {
+            return _next(_head.load()) == _tail.load();
+        }
+
+        // ----------------------------------------- Consumer
+
+        /**
+         * @brief Pop data from the buffer. Consumer side only!
+         *
+         * @param data Data to be popped from the buffer
+         * @return true if the buffer is not empty, false otherwise
+         */
+        bool pop(T &data) {
+            CounterType tail = _tail.loadOwn();
+
+            if (tail == _head.load()) return false; // -> empty
+
+            data = _pool[tail];
+            _tail.store(_next(tail));
+
+            return true;
+        }
+
+        /**
+         * @brief Peek the oldest Element without popping. Consumer side only!
+         *
+         * @param data Oldest Element in Buffer
+         * @return true If the buffer is not empty
+         * @return false If the buffer is empty and nothing got peeked
+         */
+        bool peek(T &data) const {
+            CounterType tail = _tail.loadOwn();
+
+            if (tail == _head.load()) return false; // -> empty
+
+            data = _pool[tail];
+            return true;
+        }
+
+        /**
+         * @brief Check if the buffer is empty. Exact for the consumer, a snapshot for the producer.
+         *
+         * @return true if the buffer is empty
+         * @return false if one or more elements are in the buffer
+         */
+        bool empty() const {
+            return _head.load() == _tail.load();
+        }
+
+        // ----------------------------------------- Both
+
+        /**
+         * @brief Returns the number of elements currently stored in the buffer. Only a snapshot while
+         * the other side is active.
+         *
+         * @return CounterType number of elements currently stored in the buffer
+         */
+        CounterType size() const {
+            CounterType head = _head.load();
+            CounterType tail = _tail.load();
+
+            if (head < tail) {
+                return (BufferSize + 1) + head - tail;
+            } else {
+                return head - tail;
+            }
+        }
+
+        /**
+         * @brief Returns the maximum count of elements the buffer can hold
+         *
+         * @return CounterType
+         */
+        static constexpr CounterType capacity() {
+            return BufferSize;
+        }
+
+        /**
+         * @brief Reset the Buffer, marks all Elements as free. Neither side may access the buffer at
+         * the same time!
+         *
+         */
+        void reset() {
+            _head.store(0);
+            _tail.store(0);
+        }
+
+        /**
+         * @brief Returns the count of rejected elements since the last resetStatistics(), e.g. to
+         * detect overruns of the consumer
+         *
+         * @return uint32_t
+         */
+        uint32_t dropCount() const {
+            return _dropCount.load();
+        }
+
+        /**
+         * @brief Returns the highest count of elements stored at once since the last
+         * resetStatistics() (high-water mark), as seen by the producer. Use it to size the buffer.
+         *
+         * @return CounterType
+         */
+        CounterType peakSize() const {
+            return _peakSize.load();
+        }
+
+        /**
+         * @brief Reset the drop count and the high-water mark. The producer may not push at the same
+         * time!
+         *
+         */
+        void resetStatistics() {
+            _dropCount.store(0);
+            _peakSize.store(0);
+        }
+
+    private:
+        // One slot always stays free to tell a full from an empty buffer without a shared flag
+        T _pool[BufferSize + 1];
+        steroido_intern::SPSCIndex<CounterType> _head; // written by the producer only
+        steroido_intern::SPSCIndex<CounterType> _tail; // written by the consumer only
+
+        // Statistics, written by the producer only
+        steroido_intern::SPSCIndex<uint32_t> _dropCount;
+        steroido_intern::SPSCIndex<CounterType> _peakSize;
+
+        bool _tryPush(const T &data) {
+            CounterType head = _head.loadOwn();
+            CounterType nextHead = _next(head);
+            CounterType tail = _tail.load();
+
+            if (nextHead == tail) return false; // -> full
+
+            _pool[head] = data;
+            _head.store(nextHead);
+
+            // Fill level when the tail was loaded, the consumer may have popped in the meantime
+            CounterType filled = nextHead >= tail ? nextHead - tail : (BufferSize + 1) + nextHead - tail;
+            if (filled > _peakSize.loadOwn()) _peakSize.store(filled);
+
+            return true;
+        }
+
+        static CounterType _next(CounterType index) {
+            ++index;
+            if (index == BufferSize + 1) {
+                index = 0;
+            }
+            return index;
+        }
+};
+
+#endif // SPSC_CIRCULAR_BUFFER_H
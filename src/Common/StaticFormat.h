@@ -0,0 +1,465 @@
+#ifndef STATIC_FORMAT_H
+#define STATIC_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "TypeTraits.h"
+#include "Libraries/printf/printf.h"
+
+/*
+    printf with the format string parsed at compile time:
+
+        staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%s: %5.2f V\n"), name, voltage);
+
+    The format gets split into literal runs and conversions by the compiler, each call only runs the
+    conversions with their flags, width and precision as constants (no parsing, no varargs). The
+    arguments are checked against the conversions: a wrong count or e.g. a float for %d does not
+    compile. Integers are formatted as their own type, so length modifiers (l, ll, h, z...) are
+    accepted but not needed. Width and precision must be written into the format ('*' is not supported).
+*/
+
+/**
+ * @brief Format string known at compile time, create it with STEROIDO_FORMAT("...")
+ *
+ * @tparam Literal Type providing the string as static constexpr get()
+ */
+template<class Literal>
+struct StaticFormat {
+    static constexpr const char* string() {
+        return Literal::get();
+    }
+};
+
+/**
+ * @brief Create a StaticFormat from a string literal
+ *
+ */
+#define STEROIDO_FORMAT(literal) ([]() { \
+        struct SteroidoFormatLiteral { static constexpr const char* get() { return literal; } }; \
+        return StaticFormat<SteroidoFormatLiteral>(); \
+    }())
+
+namespace steroido_intern {
+    // ----------------------------------------- Parsing (at compile time)
+
+    constexpr bool _formatIsDigit(char character) {
+        return character >= '0' && character <= '9';
+    }
+
+    constexpr unsigned int _formatFlag(char character) {
+        return character == '0' ? FLAGS_ZEROPAD
+            : character == '-' ? FLAGS_LEFT
+            : character == '+' ? FLAGS_PLUS
+            : character == ' ' ? FLAGS_SPACE
+            : character == '#' ? FLAGS_HASH
+            : 0U;
+    }
+
+    constexpr unsigned int _formatFlags(const char *format, size_t pos) {
+        return _formatFlag(format[pos]) ? _formatFlag(format[pos]) | _formatFlags(format, pos + 1) : 0U;
+    }
+
+    constexpr size_t _formatSkipFlags(const char *format, size_t pos) {
+        return _formatFlag(format[pos]) ? _formatSkipFlags(format, pos + 1) : pos;
+    }
+
+    constexpr size_t _formatSkipDigits(const char *format, size_t pos) {
+        return _formatIsDigit(format[pos]) ? _formatSkipDigits(format, pos + 1) : pos;
+    }
+
+    constexpr unsigned int _formatNumber(const char *format, size_t pos, unsigned int value = 0U) {
+        return _formatIsDigit(format[pos]) ? _formatNumber(format, pos + 1, value * 10U + (format[pos] - '0')) : value;
+    }
+
+    constexpr size_t _formatSkipLength(const char *format, size_t pos) {
+        return (format[pos] == 'l' || format[pos] == 'h') ? (format[pos + 1] == format[pos] ? pos + 2 : pos + 1)
+            : (format[pos] == 'z' || format[pos] == 'j' || format[pos] == 't' || format[pos] == 'L') ? pos + 1
+            : pos;
+    }
+
+    // End of the literal run starting at pos (the next '%' or the end of the string)
+    constexpr size_t _formatLiteralEnd(const char *format, size_t pos) {
+        return (format[pos] == 0 || format[pos] == '%') ? pos : _formatLiteralEnd(format, pos + 1);
+    }
+
+    enum _FormatStepKind {
+        _FormatEnd,
+        _FormatPercent,
+        _FormatConversion
+    };
+
+    constexpr _FormatStepKind _formatStepKind(const char *format, size_t pos) {
+        return format[pos] == 0 ? _FormatEnd : format[pos + 1] == '%' ? _FormatPercent : _FormatConversion;
+    }
+
+    /**
+     * @brief A conversion (%[flags][width][.precision][length]conversion) parsed at compile time
+     *
+     * @tparam Literal
+     * @tparam Pos Position of the '%'
+     */
+    template<class Literal, size_t Pos>
+    struct _FormatSpec {
+        static constexpr size_t flagsEnd = _formatSkipFlags(Literal::get(), Pos + 1);
+        static constexpr size_t widthEnd = _formatSkipDigits(Literal::get(), flagsEnd);
+        static constexpr bool hasPrecision = Literal::get()[widthEnd] == '.';
+        static constexpr size_t precisionStart = widthEnd + (hasPrecision ? 1 : 0);
+        static constexpr size_t lengthStart = _formatSkipDigits(Literal::get(), precisionStart);
+        static constexpr size_t conversionPos = _formatSkipLength(Literal::get(), lengthStart);
+
+        static constexpr unsigned int flags = _formatFlags(Literal::get(), Pos + 1) | (hasPrecision ? FLAGS_PRECISION : 0U);
+        static constexpr unsigned int width = _formatNumber(Literal::get(), flagsEnd);
+        static constexpr unsigned int precision = _formatNumber(Literal::get(), precisionStart);
+        static constexpr char conversion = Literal::get()[conversionPos];
+        static constexpr size_t end = conversionPos + 1;
+
+        static_assert(Literal::get()[flagsEnd] != '*' && Literal::get()[precisionStart] != '*',
+            "'*' is not supported by StaticFormat, write the width/precision into the format");
+    };
+
+    // ----------------------------------------- Conversions (at runtime)
+
+    template<char Conversion>
+    struct _FormatUnsupported : FalseType {};
+
+    template<typename T>
+    struct _FormatWrongArgument : FalseType {};
+
+    /**
+     * @brief Where the output goes, passed by reference to keep the calls at each call site small
+     *
+     */
+    struct _FormatOutput {
+        out_fct_type out;
+        char *buffer;
+        size_t idx;
+        size_t maxlen;
+    };
+
+    /**
+     * @brief Constant parameters of a conversion, stored once for all call sites using the same
+     *
+     */
+    struct _FormatParameters {
+        unsigned int base;
+        unsigned int precision;
+        unsigned int width;
+        unsigned int flags;
+    };
+
+    template<unsigned int Base, unsigned int Precision, unsigned int Width, unsigned int Flags>
+    struct _FormatParameterTable {
+        static constexpr _FormatParameters parameters = {Base, Precision, Width, Flags};
+    };
+
+    template<unsigned int Base, unsigned int Precision, unsigned int Width, unsigned int Flags>
+    constexpr _FormatParameters _FormatParameterTable<Base, Precision, Width, Flags>::parameters;
+
+    inline void _formatWrite(_FormatOutput &output, const char *text, size_t length) {
+        const out_fct_type out = output.out;
+        size_t idx = output.idx;
+        while (length--) {
+            out(*(text++), output.buffer, idx++, output.maxlen);
+        }
+        output.idx = idx;
+    }
+
+    inline void _formatPad(_FormatOutput &output, unsigned int length, unsigned int width) {
+        while (length++ < width) {
+            output.out(' ', output.buffer, output.idx++, output.maxlen);
+        }
+    }
+
+    inline void _formatInteger(_FormatOutput &output, unsigned long value, bool negative, const _FormatParameters &parameters) {
+        output.idx = _ntoa_long(output.out, output.buffer, output.idx, output.maxlen, value, negative,
+            parameters.base, parameters.precision, parameters.width, parameters.flags);
+    }
+
+#if defined(PRINTF_SUPPORT_LONG_LONG)
+    inline void _formatInteger(_FormatOutput &output, unsigned long long value, bool negative, const _FormatParameters &parameters) {
+        output.idx = _ntoa_long_long(output.out, output.buffer, output.idx, output.maxlen, value, negative,
+            parameters.base, parameters.precision, parameters.width, parameters.flags);
+    }
+#endif
+
+#if defined(PRINTF_SUPPORT_FLOAT)
+    inline void _formatFloat(_FormatOutput &output, double value, const _FormatParameters &parameters) {
+        #if defined(PRINTF_SUPPORT_EXPONENTIAL)
+            if (parameters.base) {
+                output.idx = _etoa(output.out, output.buffer, output.idx, output.maxlen, value, parameters.precision, parameters.width, parameters.flags);
+                return;
+            }
+        #endif
+        output.idx = _ftoa(output.out, output.buffer, output.idx, output.maxlen, value, parameters.precision, parameters.width, parameters.flags);
+    }
+#endif
+
+    inline void _formatCharacter(_FormatOutput &output, char value, const _FormatParameters &parameters) {
+        if (!(parameters.flags & FLAGS_LEFT)) _formatPad(output, 1U, parameters.width);
+        output.out(value, output.buffer, output.idx++, output.maxlen);
+        if (parameters.flags & FLAGS_LEFT) _formatPad(output, 1U, parameters.width);
+    }
+
+    inline void _formatString(_FormatOutput &output, const char *value, const _FormatParameters &parameters) {
+        const unsigned int length = _strnlen_s(value, (parameters.flags & FLAGS_PRECISION) ? parameters.precision : (size_t)-1);
+
+        if (!(parameters.flags & FLAGS_LEFT)) _formatPad(output, length, parameters.width);
+        _formatWrite(output, value, length);
+        if (parameters.flags & FLAGS_LEFT) _formatPad(output, length, parameters.width);
+    }
+
+    template<typename T>
+    inline bool _formatIsNegative(T value, TrueType) {
+        return value < 0;
+    }
+
+    template<typename T>
+    inline bool _formatIsNegative(T, FalseType) {
+        return false;
+    }
+
+    /**
+     * @brief Integer type an argument is formatted as: enumerations as their underlying type,
+     * without const/volatile
+     *
+     */
+    template<typename T, bool Enum = IsEnum<T>::value>
+    struct _FormatIntegerType {
+        typedef typename RemoveCV<T>::type type;
+    };
+
+    template<typename T>
+    struct _FormatIntegerType<T, true> {
+        typedef typename UnderlyingType<typename RemoveCV<T>::type>::type type;
+    };
+
+    /**
+     * @brief Conversion of an argument, specialized for each supported conversion character
+     *
+     * @tparam Conversion
+     */
+    template<char Conversion>
+    struct _FormatConverter {
+        static_assert(_FormatUnsupported<Conversion>::value, "Unsupported conversion in the format string");
+
+        template<class Spec, typename T>
+        static void convert(_FormatOutput&, const T&) {}
+    };
+
+    // d i u x X o b
+    template<bool Signed, unsigned int Base, unsigned int ExtraFlags>
+    struct _FormatIntegerConverter {
+        template<class Spec, typename Argument>
+        static void convert(_FormatOutput &output, const Argument &argument) {
+            typedef typename _FormatIntegerType<Argument>::type T;
+            static_assert(IsIntegral<T>::value, "Integer conversion (%d %i %u %x %X %o %b) needs an integer or enum argument");
+            const T value = static_cast<T>(argument);
+
+            // unsigned long where it is big enough, so 32 bit targets stay in 32 bit math
+            typedef typename Conditional<(sizeof(T) <= sizeof(unsigned long)), unsigned long, unsigned long long>::type Unsigned;
+            typedef _FormatParameterTable<Base, Spec::precision, Spec::width, (Spec::flags | ExtraFlags)
+                & ~(Signed ? 0U : (FLAGS_PLUS | FLAGS_SPACE))
+                & ~(Base == 10U ? FLAGS_HASH : 0U)
+                & ~((Spec::flags & FLAGS_PRECISION) ? FLAGS_ZEROPAD : 0U)> Table;
+
+            const bool negative = Signed && _formatIsNegative(value, BoolConstant<IsSigned<T>::value>());
+            Unsigned magnitude = static_cast<Unsigned>(value);
+            if (negative) {
+                magnitude = 0 - magnitude;
+            }
+            else if (sizeof(T) < sizeof(Unsigned)) {
+                // negative values of signed types for %u/%x... are shown like their own unsigned type
+                magnitude &= (static_cast<Unsigned>(1) << (8 * sizeof(T) % (8 * sizeof(Unsigned)))) - 1U;
+            }
+
+            _formatInteger(output, magnitude, negative, Table::parameters);
+        }
+    };
+
+    template<> struct _FormatConverter<'d'> : _FormatIntegerConverter<true, 10U, 0U> {};
+    template<> struct _FormatConverter<'i'> : _FormatIntegerConverter<true, 10U, 0U> {};
+    template<> struct _FormatConverter<'u'> : _FormatIntegerConverter<false, 10U, 0U> {};
+    template<> struct _FormatConverter<'x'> : _FormatIntegerConverter<false, 16U, 0U> {};
+    template<> struct _FormatConverter<'X'> : _FormatIntegerConverter<false, 16U, FLAGS_UPPERCASE> {};
+    template<> struct _FormatConverter<'o'> : _FormatIntegerConverter<false, 8U, 0U> {};
+    template<> struct _FormatConverter<'b'> : _FormatIntegerConverter<false, 2U, 0U> {};
+
+#if defined(PRINTF_SUPPORT_FLOAT)
+    // f F e E g G, base is used as "exponential"
+    template<bool Exponential, unsigned int ExtraFlags>
+    struct _FormatFloatConverter {
+        template<class Spec, typename T>
+        static void convert(_FormatOutput &output, const T &value) {
+            static_assert(IsFloatingPoint<T>::value, "Float conversion (%f %e %g) needs a floating point argument");
+            #if !defined(PRINTF_SUPPORT_EXPONENTIAL)
+                static_assert(!Exponential, "%e and %g need PRINTF_SUPPORT_EXPONENTIAL");
+            #endif
+
+            typedef _FormatParameterTable<Exponential ? 1U : 0U, Spec::precision, Spec::width, Spec::flags | ExtraFlags> Table;
+            _formatFloat(output, static_cast<double>(value), Table::parameters);
+        }
+    };
+
+    template<> struct _FormatConverter<'f'> : _FormatFloatConverter<false, 0U> {};
+    template<> struct _FormatConverter<'F'> : _FormatFloatConverter<false, FLAGS_UPPERCASE> {};
+    template<> struct _FormatConverter<'e'> : _FormatFloatConverter<true, 0U> {};
+    template<> struct _FormatConverter<'E'> : _FormatFloatConverter<true, FLAGS_UPPERCASE> {};
+    template<> struct _FormatConverter<'g'> : _FormatFloatConverter<true, FLAGS_ADAPT_EXP> {};
+    template<> struct _FormatConverter<'G'> : _FormatFloatConverter<true, FLAGS_ADAPT_EXP | FLAGS_UPPERCASE> {};
+#endif
+
+    template<>
+    struct _FormatConverter<'c'> {
+        template<class Spec, typename Argument>
+        static void convert(_FormatOutput &output, const Argument &argument) {
+            typedef typename _FormatIntegerType<Argument>::type T;
+            static_assert(IsIntegral<T>::value, "%c needs a character (integer) argument");
+            const T value = static_cast<T>(argument);
+
+            typedef _FormatParameterTable<0U, 0U, Spec::width, Spec::flags> Table;
+            _formatCharacter(output, static_cast<char>(value), Table::parameters);
+        }
+    };
+
+    template<>
+    struct _FormatConverter<'s'> {
+        template<class Spec>
+        static void convert(_FormatOutput &output, const char *value) {
+            typedef _FormatParameterTable<0U, Spec::precision, Spec::width, Spec::flags> Table;
+            _formatString(output, value, Table::parameters);
+        }
+
+        template<class Spec>
+        static void convert(_FormatOutput &output, char *value) {
+            convert<Spec>(output, static_cast<const char*>(value));
+        }
+
+        template<class Spec, typename T>
+        static void convert(_FormatOutput&, const T&) {
+            static_assert(_FormatWrongArgument<T>::value, "%s needs a string (const char*) argument");
+        }
+    };
+
+    template<>
+    struct _FormatConverter<'p'> {
+        template<class Spec, typename T>
+        static void convert(_FormatOutput &output, T *value) {
+            typedef typename Conditional<(sizeof(uintptr_t) <= sizeof(unsigned long)), unsigned long, unsigned long long>::type Unsigned;
+            typedef _FormatParameterTable<16U, Spec::precision, sizeof(void*) * 2U, Spec::flags | FLAGS_ZEROPAD | FLAGS_UPPERCASE> Table;
+            _formatInteger(output, static_cast<Unsigned>(reinterpret_cast<uintptr_t>(value)), false, Table::parameters);
+        }
+
+        template<class Spec, typename T>
+        static void convert(_FormatOutput&, const T&) {
+            static_assert(_FormatWrongArgument<T>::value, "%p needs a pointer argument");
+        }
+    };
+
+    // ----------------------------------------- Steps through the format
+
+    template<class Literal, size_t Pos, _FormatStepKind Kind = _formatStepKind(Literal::get(), Pos)>
+    struct _FormatStep;
+
+    /**
+     * @brief Literal run starting at Pos, followed by the next step
+     *
+     */
+    template<class Literal, size_t Pos>
+    struct _FormatRun {
+        static constexpr size_t end = _formatLiteralEnd(Literal::get(), Pos);
+
+        template<typename... Args>
+        static void emit(_FormatOutput &output, const Args&... args) {
+            if (end > Pos) {
+                _formatWrite(output, Literal::get() + Pos, end - Pos);
+            }
+            _FormatStep<Literal, end>::emit(output, args...);
+        }
+    };
+
+    template<class Literal, size_t Pos>
+    struct _FormatStep<Literal, Pos, _FormatEnd> {
+        template<typename... Args>
+        static void emit(_FormatOutput&, const Args&...) {
+            static_assert(sizeof...(Args) == 0, "More arguments than conversions in the format string");
+        }
+    };
+
+    template<class Literal, size_t Pos>
+    struct _FormatStep<Literal, Pos, _FormatPercent> {
+        template<typename... Args>
+        static void emit(_FormatOutput &output, const Args&... args) {
+            output.out('%', output.buffer, output.idx++, output.maxlen);
+            _FormatRun<Literal, Pos + 2>::emit(output, args...);
+        }
+    };
+
+    template<class Literal, size_t Pos>
+    struct _FormatStep<Literal, Pos, _FormatConversion> {
+        typedef _FormatSpec<Literal, Pos> Spec;
+
+        template<typename T, typename... Args>
+        static void emit(_FormatOutput &output, const T &value, const Args&... args) {
+            _FormatConverter<Spec::conversion>::template convert<Spec>(output, value);
+            _FormatRun<Literal, Spec::end>::emit(output, args...);
+        }
+
+        template<typename... None>
+        static void emit(_FormatOutput&, const None&...) {
+            static_assert(sizeof...(None) != 0, "Fewer arguments than conversions in the format string");
+        }
+    };
+
+    template<class Literal, typename... Args>
+    inline size_t formatStatic(out_fct_type out, char *buffer, size_t maxlen, const Args&... args) {
+        _FormatOutput output = {out, buffer, 0U, maxlen};
+        _FormatRun<Literal, 0>::emit(output, args...);
+        return output.idx;
+    }
+};
+
+/**
+ * @brief Same as snprintf, with the format parsed at compile time
+ *
+ * @param buffer
+ * @param count Size of the buffer, the output gets cut off (and is always terminated)
+ * @param format STEROIDO_FORMAT("...")
+ * @param args Arguments for the conversions of the format, checked at compile time
+ * @return int Count of characters the full output has (without terminating zero)
+ */
+template<class Literal, typename... Args>
+int staticSnprintf(char *buffer, size_t count, StaticFormat<Literal>, const Args&... args) {
+    size_t length = steroido_intern::formatStatic<Literal>(_out_buffer, buffer, count, args...);
+    _out_buffer(0, buffer, length < count ? length : count - 1U, count);
+    return (int)length;
+}
+
+/**
+ * @brief Same as printf (output with _putchar), with the format parsed at compile time
+ *
+ * @param format STEROIDO_FORMAT("...")
+ * @param args Arguments for the conversions of the format, checked at compile time
+ * @return int Count of characters written
+ */
+template<class Literal, typename... Args>
+int staticPrintf(StaticFormat<Literal>, const Args&... args) {
+    char buffer[1];
+    return (int)steroido_intern::formatStatic<Literal>(_out_char, buffer, (size_t)-1, args...);
+}
+
+/**
+ * @brief Same as fctprintf (output with a function), with the format parsed at compile time
+ *
+ * @param out Function called for each character
+ * @param arg Argument passed to out
+ * @param format STEROIDO_FORMAT("...")
+ * @param args Arguments for the conversions of the format, checked at compile time
+ * @return int Count of characters written
+ */
+template<class Literal, typename... Args>
+int staticFctprintf(void (*out)(char character, void *arg), void *arg, StaticFormat<Literal>, const Args&... args) {
+    const out_fct_wrap_type wrap = { out, arg };
+    return (int)steroido_intern::formatStatic<Literal>(_out_fct, (char*)(uintptr_t)&wrap, (size_t)-1, args...);
+}
+
+#endif // STATIC_FORMAT_H
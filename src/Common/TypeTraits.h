@@ -0,0 +1,212 @@
+#ifndef TYPE_TRAITS_H
+#define TYPE_TRAITS_H
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+    Minimal replacements for <type_traits>, <utility> and <new>, which are not available on every
+    platform (e.g. AVR). Everything lives in steroido_intern, so it never collides with the STL.
+*/
+
+namespace steroido_intern {
+    /**
+     * @brief Tag selecting the placement new below, so <new> is not needed
+     *
+     */
+    struct PlacementTag {};
+};
+
+inline void* operator new(size_t, void *place, steroido_intern::PlacementTag) noexcept {
+    return place;
+}
+
+inline void operator delete(void*, void*, steroido_intern::PlacementTag) noexcept {}
+
+namespace steroido_intern {
+    template<bool Value>
+    struct BoolConstant {
+        static constexpr bool value = Value;
+    };
+
+    typedef BoolConstant<true> TrueType;
+    typedef BoolConstant<false> FalseType;
+
+    template<typename T> struct RemoveReference { typedef T type; };
+    template<typename T> struct RemoveReference<T&> { typedef T type; };
+    template<typename T> struct RemoveReference<T&&> { typedef T type; };
+
+    template<typename T> struct RemoveCV { typedef T type; };
+    template<typename T> struct RemoveCV<const T> { typedef T type; };
+    template<typename T> struct RemoveCV<volatile T> { typedef T type; };
+    template<typename T> struct RemoveCV<const volatile T> { typedef T type; };
+
+    /**
+     * @brief Same as std::type_identity, a parameter of type TypeIdentity<T>::type does not take
+     * part in the deduction of T
+     *
+     */
+    template<typename T> struct TypeIdentity { typedef T type; };
+
+    /**
+     * @brief Same as std::conditional, type is IfTrue or IfFalse
+     *
+     */
+    template<bool Condition, typename IfTrue, typename IfFalse> struct Conditional { typedef IfTrue type; };
+    template<typename IfTrue, typename IfFalse> struct Conditional<false, IfTrue, IfFalse> { typedef IfFalse type; };
+
+    /**
+     * @brief True for the built-in integer types (including bool and the character types), also
+     * const and/or volatile
+     *
+     * @tparam T
+     */
+    template<typename T> struct IsIntegral : FalseType {};
+    template<> struct IsIntegral<bool> : TrueType {};
+    template<> struct IsIntegral<char> : TrueType {};
+    template<> struct IsIntegral<signed char> : TrueType {};
+    template<> struct IsIntegral<unsigned char> : TrueType {};
+    template<> struct IsIntegral<wchar_t> : TrueType {};
+    template<> struct IsIntegral<char16_t> : TrueType {};
+    template<> struct IsIntegral<char32_t> : TrueType {};
+    template<> struct IsIntegral<short> : TrueType {};
+    template<> struct IsIntegral<unsigned short> : TrueType {};
+    template<> struct IsIntegral<int> : TrueType {};
+    template<> struct IsIntegral<unsigned int> : TrueType {};
+    template<> struct IsIntegral<long> : TrueType {};
+    template<> struct IsIntegral<unsigned long> : TrueType {};
+    template<> struct IsIntegral<long long> : TrueType {};
+    template<> struct IsIntegral<unsigned long long> : TrueType {};
+    template<typename T> struct IsIntegral<const T> : IsIntegral<T> {};
+    template<typename T> struct IsIntegral<volatile T> : IsIntegral<T> {};
+    template<typename T> struct IsIntegral<const volatile T> : IsIntegral<T> {};
+
+    /**
+     * @brief True for float, double and long double, also const and/or volatile
+     *
+     * @tparam T
+     */
+    template<typename T> struct IsFloatingPoint : FalseType {};
+    template<> struct IsFloatingPoint<float> : TrueType {};
+    template<> struct IsFloatingPoint<double> : TrueType {};
+    template<> struct IsFloatingPoint<long double> : TrueType {};
+    template<typename T> struct IsFloatingPoint<const T> : IsFloatingPoint<T> {};
+    template<typename T> struct IsFloatingPoint<volatile T> : IsFloatingPoint<T> {};
+    template<typename T> struct IsFloatingPoint<const volatile T> : IsFloatingPoint<T> {};
+
+    /**
+     * @brief True for enumerations (scoped and unscoped)
+     *
+     * @tparam T
+     */
+    template<typename T> struct IsEnum : BoolConstant<__is_enum(T)> {};
+
+    /**
+     * @brief Same as std::underlying_type, the integer type an enumeration is stored as
+     *
+     * @tparam T An enumeration without const/volatile
+     */
+    template<typename T> struct UnderlyingType { typedef __underlying_type(T) type; };
+
+    /**
+     * @brief True for the arithmetic types which can hold negative values
+     *
+     * @tparam T
+     */
+    template<typename T, bool Arithmetic = IsIntegral<T>::value || IsFloatingPoint<T>::value>
+    struct IsSigned : FalseType {};
+
+    template<typename T>
+    struct IsSigned<T, true> : BoolConstant<typename RemoveCV<T>::type(-1) < typename RemoveCV<T>::type(0)> {};
+
+    /**
+     * @brief True if T can be copied with memcpy (no user defined copy/move/destructor)
+     *
+     * @tparam T
+     */
+    template<typename T>
+    struct IsTriviallyCopyable : BoolConstant<
+        #if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
+            __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #else
+            __is_trivially_copyable(T)
+        #endif
+    > {};
+
+    /**
+     * @brief Same as std::move
+     *
+     */
+    template<typename T>
+    constexpr typename RemoveReference<T>::type&& move(T &&value) noexcept {
+        return static_cast<typename RemoveReference<T>::type&&>(value);
+    }
+
+    /**
+     * @brief Same as std::forward
+     *
+     */
+    template<typename T>
+    constexpr T&& forward(typename RemoveReference<T>::type &value) noexcept {
+        return static_cast<T&&>(value);
+    }
+
+    template<typename T>
+    constexpr T&& forward(typename RemoveReference<T>::type &&value) noexcept {
+        return static_cast<T&&>(value);
+    }
+
+    /**
+     * @brief Construct an object in already allocated memory
+     *
+     * @tparam T Type of the object
+     * @param place Memory for the object
+     * @param args Arguments passed to the constructor of T
+     * @return T* the constructed object
+     */
+    template<typename T, typename... Args>
+    inline T* construct(void *place, Args&&... args) {
+        return new (place, PlacementTag()) T(steroido_intern::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Call the destructors of count objects, the memory stays allocated
+     *
+     * @tparam T
+     * @param first
+     * @param count
+     */
+    template<typename T>
+    inline void destroy(T *first, size_t count) {
+        while (count--) (first++)->~T();
+    }
+
+    template<typename T>
+    inline void _relocate(T *dest, T *src, size_t count, TrueType) {
+        if (count) memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
+    }
+
+    template<typename T>
+    inline void _relocate(T *dest, T *src, size_t count, FalseType) {
+        for (size_t i = 0; i < count; ++i) {
+            construct<T>(dest + i, steroido_intern::move(src[i]));
+            src[i].~T();
+        }
+    }
+
+    /**
+     * @brief Move count objects into uninitialized memory and destroy the originals. Trivially
+     * copyable objects are copied bitwise at once, all others are move constructed one by one.
+     *
+     * @tparam T
+     * @param dest Uninitialized memory, must not overlap with src
+     * @param src Objects to be moved, uninitialized memory afterwards
+     * @param count
+     */
+    template<typename T>
+    inline void relocate(T *dest, T *src, size_t count) {
+        _relocate(dest, src, count, BoolConstant<IsTriviallyCopyable<T>::value>());
+    }
+};
+
+#endif // TYPE_TRAITS_H
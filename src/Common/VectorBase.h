@@ -0,0 +1,702 @@
+#ifndef VECTOR_BASE_H
+#define VECTOR_BASE_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "NonCopyable.h"
+#include "PoolAllocator.h"
+#include "TypeTraits.h"
+
+#define VECTOR_AUTO_PRERESERVED_SPACE 4
+#define VECTOR_AUTO_RESERVE_MULTIPLICATOR 2
+#define VECTOR_AUTO_RESERVE_ADDITION 0
+
+namespace steroido_intern {
+
+/**
+ * Implementation shared by vector, small_vector and static_vector. The derived class owns the memory
+ * of the elements and provides:
+ * - bool _allocate(counter_type &new_cap, T* &data): memory for at least new_cap elements (new_cap may
+ *   be rounded up), false if there is none
+ * - void _free(T* data): gives back memory of _allocate()
+ * - optionally bool _reallocate(T* &data, counter_type &new_cap): resizes the memory keeping the elements
+ *   (e.g. in place), false if not possible
+ * It has to call clear() in its destructor.
+ * @tparam T Type of the elements.
+ * @tparam counter_type Type the elements are counted with.
+ * @tparam Derived The derived class itself.
+ */
+template<class T, typename counter_type, class Derived>
+class VectorBase : private NonCopyable<Derived> {
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using iterator = pointer;
+        using const_iterator = const T*;
+
+        /**
+         * Element access.
+         * @param pos Position of the element.
+         * @return Element at that position.
+         */
+        reference at(counter_type pos) {
+            if (pos >= _currentElementCount) {
+                return *_begin;
+            }
+            return _begin[pos];
+        }
+
+        /**
+         * Element access.
+         * @param pos Position of the element.
+         * @return Element at that position.
+         */
+        reference operator[](counter_type pos) {
+            return at(pos);
+        }
+
+        /**
+         * Element at the front.
+         * @return First element.
+         */
+        reference front() {
+            return *_begin;
+        }
+
+        /**
+         * Element at the end.
+         * @return Last element.
+         */
+        reference back() {
+            if (empty()) {
+                return *_begin;
+            }
+            return _begin[_currentElementCount - 1];
+        }
+
+        /**
+         * Raw data array the elements are stored in.
+         * @return Pointer to that array.
+         */
+        T* data() noexcept {
+            if (empty()) {
+                return nullptr;
+            }
+            return _begin;
+        }
+
+        /**
+         * Iterator on the first element.
+         * @return Iterator.
+         */
+        iterator begin() noexcept {
+            return _begin;
+        }
+
+        const_iterator begin() const noexcept {
+            return _begin;
+        }
+
+        /**
+         * Iterator on the after-last element.
+         * @return Iterator.
+         */
+        iterator end() noexcept {
+            return _begin + _currentElementCount;
+        }
+
+        const_iterator end() const noexcept {
+            return _begin + _currentElementCount;
+        }
+
+        /**
+         * If there are no elements inside.
+         * @return If empty.
+         */
+        bool empty() const noexcept {
+            return _currentElementCount == 0;
+        }
+
+        /**
+         * Current number of elements inside.
+         * @return Element count.
+         */
+        counter_type size() const noexcept {
+            return _currentElementCount;
+        }
+
+        /**
+         * Allocates memory for the specified number of elements.
+         * @param new_cap Total number of elements.
+         */
+        void reserve(counter_type new_cap) {
+            if (new_cap > _currentSize) {
+                _changeCapacity(new_cap);
+            }
+        }
+
+        /**
+         * How many elements can fit inside without reallocation.
+         * @return Current capacity.
+         */
+        counter_type capacity() const noexcept {
+            return _currentSize;
+        }
+
+        /**
+         * Reallocates memory so only the currently contained elements fit inside.
+         */
+        void shrink_to_fit() {
+            if (_currentSize > _currentElementCount) {
+                _changeCapacity(_currentElementCount);
+            }
+        }
+
+        /**
+         * Removes all elements and releases the memory.
+         */
+        void clear() noexcept {
+            steroido_intern::destroy(_begin, _currentElementCount);
+            _currentElementCount = 0;
+            _changeCapacity(0);
+        }
+
+        /**
+         * Removes one element.
+         * @param pos Position of the element.
+         * @return Position the element had been at.
+         */
+        iterator erase(iterator pos) {
+            if (pos >= end()) {
+                return end();
+            }
+
+            return erase(pos, pos + 1);
+        }
+
+        /**
+         * Removes all elements in the range in a single pass.
+         * @param first Position of the first element to be removed.
+         * @param last Position after the last element to be removed.
+         * @return Position the first element had been at.
+         */
+        iterator erase(iterator first, iterator last) {
+            if (first > last || last > end()) {
+                return end();
+            }
+
+            counter_type count = last - first;
+            if (!count) {
+                return first;
+            }
+
+            // Move the following elements to the front, then destroy the now unused last ones
+            if (IsTriviallyCopyable<T>::value) {
+                memmove(static_cast<void*>(first), static_cast<const void*>(last), (end() - last) * sizeof(T));
+            } else {
+                for (iterator it = last; it != end(); ++it) {
+                    *(it - count) = steroido_intern::move(*it);
+                }
+            }
+            _destroyFrom(_currentElementCount - count);
+
+            return first;
+        }
+
+        /**
+         * Inserts an element at the end.
+         * @param value Element to insert.
+         */
+        void push_back(const T& value) {
+            _emplaceBack(value);
+        }
+
+        /**
+         * Inserts an element at the end.
+         * @param value Element to insert, will be moved.
+         */
+        void push_back(T&& value) {
+            _emplaceBack(steroido_intern::move(value));
+        }
+
+        /**
+         * Constructs an element in place at the end.
+         * @param args Arguments for the constructor of the element.
+         * @return The new element.
+         */
+        template<typename... Args>
+        reference emplace_back(Args&&... args) {
+            return *_emplaceBack(steroido_intern::forward<Args>(args)...);
+        }
+
+        /**
+         * Removes the element currently at the end.
+         */
+        void pop_back() {
+            _begin[--_currentElementCount].~T();
+        }
+
+        /**
+         * Inserts an element at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed.
+         * @param value Element itself.
+         * @return Position of the inserted element.
+         */
+        iterator insert(iterator pos, const T& value) {
+            return _emplace(pos, value);
+        }
+
+        /**
+         * Inserts an element at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed.
+         * @param value Element itself.
+         * @return Position of the inserted element.
+         */
+        iterator insert(iterator pos, T&& value) {
+            return _emplace(pos, steroido_intern::move(value));
+        }
+
+        /**
+         * Inserts count copies of an element at the specified position, shifting the following elements only once.
+         * @param pos Position the elements will be placed.
+         * @param count Number of elements.
+         * @param value Element to be copied.
+         * @return Position of the first inserted element, end() if they could not be inserted.
+         */
+        iterator insert(iterator pos, counter_type count, const T& value) {
+            // The value might be an element of this vector, which gets moved
+            T copy(value);
+            return _insertN(pos, count, _Fill{copy});
+        }
+
+        /**
+         * Inserts copies of the elements of an array at the specified position, shifting the following elements
+         * only once. The array must not be part of this vector.
+         * @param pos Position the elements will be placed.
+         * @param first First element of the array.
+         * @param last Position after the last element of the array.
+         * @return Position of the first inserted element, end() if they could not be inserted.
+         */
+        iterator insert(iterator pos, const T* first, const T* last) {
+            return _insertN(pos, last - first, first);
+        }
+
+        /**
+         * Constructs an element in place at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed, end() appends it.
+         * @param args Arguments for the constructor of the element.
+         * @return Position of the inserted element.
+         */
+        template<typename... Args>
+        iterator emplace(iterator pos, Args&&... args) {
+            return _emplace(pos, steroido_intern::forward<Args>(args)...);
+        }
+
+        /**
+         * Changes the number of elements, new ones are default constructed.
+         * @param count New number of elements.
+         */
+        void resize(counter_type count) {
+            _resize(count);
+        }
+
+        /**
+         * Changes the number of elements, new ones are copies of value.
+         * @param count New number of elements.
+         * @param value Element to be copied.
+         */
+        void resize(counter_type count, const T& value) {
+            _resize(count, value);
+        }
+
+        /**
+         * Replaces all elements with count copies of value.
+         * @param count New number of elements.
+         * @param value Element to be copied.
+         */
+        void assign(counter_type count, const T& value) {
+            _assign(count, value);
+        }
+
+        /**
+         * Replaces all elements with copies of the elements of an array. The array must not be part of this vector.
+         * @param first First element of the array.
+         * @param last Position after the last element of the array.
+         */
+        void assign(const T* first, const T* last) {
+            _assign(first, last);
+        }
+
+    protected:
+        VectorBase() = default;
+        ~VectorBase() = default;
+
+        /**
+         * Sets the memory of an empty vector, e.g. the inline storage of the derived class.
+         * @param data Memory for new_cap elements.
+         * @param new_cap Capacity of the memory.
+         */
+        void _useStorage(pointer data, counter_type new_cap) {
+            _begin = data;
+            _currentSize = new_cap;
+        }
+
+        /**
+         * Constructs an element at the end, grows if needed.
+         * @param args Arguments for the constructor of the element.
+         * @return The new element or nullptr if there was no memory for it.
+         */
+        template<typename... Args>
+        pointer _emplaceBack(Args&&... args) {
+            if (_currentElementCount < _currentSize) {
+                steroido_intern::construct<T>(_begin + _currentElementCount, steroido_intern::forward<Args>(args)...);
+            } else if (!_growAndEmplace(BoolConstant<IsTriviallyCopyable<T>::value>(), steroido_intern::forward<Args>(args)...)) {
+                return nullptr;
+            }
+
+            return _begin + _currentElementCount++;
+        }
+
+        /**
+         * Constructs an element at the specified position, grows if needed.
+         * @param pos Position the element will be placed, end() appends it.
+         * @param args Arguments for the constructor of the element.
+         * @return Position of the inserted element, end() if it could not be inserted.
+         */
+        template<typename... Args>
+        iterator _emplace(iterator pos, Args&&... args) {
+            if (pos > end()) {
+                return end();
+            }
+
+            counter_type index = pos - _begin;
+            if (index == _currentElementCount) {
+                return _emplaceBack(steroido_intern::forward<Args>(args)...) ? _begin + index : end();
+            }
+
+            // The arguments might refer to an element which gets moved, so construct the new one first
+            T value(steroido_intern::forward<Args>(args)...);
+
+            if (!_emplaceBack(steroido_intern::move(back()))) {
+                return end();
+            }
+            for (counter_type i = _currentElementCount - 2; i > index; --i) {
+                _begin[i] = steroido_intern::move(_begin[i - 1]);
+            }
+            _begin[index] = steroido_intern::move(value);
+
+            return _begin + index;
+        }
+
+        /**
+         * Changes the number of elements.
+         * @param count New number of elements.
+         * @param args Arguments for the constructor of new elements.
+         * @return False if there was no memory for the elements.
+         */
+        template<typename... Args>
+        bool _resize(counter_type count, const Args&... args) {
+            if (count <= _currentElementCount) {
+                _destroyFrom(count);
+                return true;
+            }
+
+            if (count > _currentSize) {
+                // The arguments might refer to an element of this vector, which gets moved
+                T value(args...);
+                if (!_reserveFor(count)) {
+                    return false;
+                }
+                return _resize(count, value);
+            }
+
+            while (_currentElementCount < count) {
+                steroido_intern::construct<T>(_begin + _currentElementCount++, args...);
+            }
+            return true;
+        }
+
+        /**
+         * Replaces all elements with count copies of value.
+         * @return False if there was no memory for the elements.
+         */
+        bool _assign(counter_type count, const T& value) {
+            T copy(value);
+            _destroyFrom(0);
+            return !count || _insertN(begin(), count, _Fill{copy}) != end();
+        }
+
+        /**
+         * Replaces all elements with copies of the elements of an array.
+         * @return False if there was no memory for the elements.
+         */
+        bool _assign(const T* first, const T* last) {
+            _destroyFrom(0);
+            return first == last || _insertN(begin(), last - first, first) != end();
+        }
+
+        /**
+         * Resizes the memory keeping the elements, not possible by default.
+         */
+        bool _reallocate(pointer&, counter_type&) {
+            return false;
+        }
+
+        /**
+         * Allocates raw memory for the elements on the heap. A block of the Steroido pool is used if enabled and
+         * the elements fit, the capacity then gets rounded up to the whole block.
+         * @param count Count of elements, might get rounded up.
+         * @return Pointer to the (uninitialized) memory.
+         */
+        static pointer _allocateRaw(counter_type &count) {
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                if (count * sizeof(T) <= SteroidoPool::blockSize()) {
+                    void *block = globalPool().allocate();
+                    if (block) {
+                        count = SteroidoPool::blockSize() / sizeof(T);
+                        return static_cast<pointer>(block);
+                    }
+                }
+            #endif
+
+            // Trivially copyable elements live in malloc() memory, so they can be realloc()ed
+            if (IsTriviallyCopyable<T>::value) {
+                return static_cast<pointer>(malloc(count * sizeof(T)));
+            }
+            return static_cast<pointer>(::operator new(count * sizeof(T)));
+        }
+
+        /**
+         * Resizes memory allocated with _allocateRaw() keeping the elements. The memory is expanded in place if
+         * possible. Only possible for trivially copyable elements on the heap.
+         * @param data Pointer to the memory.
+         * @param count New count of elements.
+         * @return Pointer to the resized memory or nullptr if not possible (data stays valid then).
+         */
+        static pointer _reallocateRaw(pointer data, counter_type count) {
+            if (!IsTriviallyCopyable<T>::value || !data || !count) {
+                return nullptr;
+            }
+
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                if (globalPool().owns(data)) {
+                    return nullptr;
+                }
+            #endif
+
+            return static_cast<pointer>(realloc(static_cast<void*>(data), count * sizeof(T)));
+        }
+
+        /**
+         * Frees memory allocated with _allocateRaw().
+         * @param data Pointer to the memory.
+         */
+        static void _freeRaw(pointer data) {
+            if (!data) return;
+
+            #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+                if (globalPool().owns(data)) {
+                    globalPool().deallocate(data);
+                    return;
+                }
+            #endif
+
+            if (IsTriviallyCopyable<T>::value) {
+                free(data);
+            } else {
+                ::operator delete(data);
+            }
+        }
+
+    private:
+        counter_type _currentSize = 0;
+        counter_type _currentElementCount = 0;
+        pointer _begin = nullptr;
+
+        /**
+         * Source for _insertN() repeating a single element.
+         */
+        struct _Fill {
+            const T &value;
+
+            const T& operator[](counter_type) const {
+                return value;
+            }
+        };
+
+        Derived& _derived() {
+            return static_cast<Derived&>(*this);
+        }
+
+        /**
+         * Grows trivially copyable elements. The memory might be resized in place and the arguments might
+         * refer to an element, so the new element is constructed before.
+         */
+        template<typename... Args>
+        bool _growAndEmplace(TrueType, Args&&... args) {
+            T value(steroido_intern::forward<Args>(args)...);
+            if (!_changeCapacity(_grownCapacity())) {
+                return false;
+            }
+
+            steroido_intern::construct<T>(_begin + _currentElementCount, value);
+            return true;
+        }
+
+        /**
+         * Grows all other elements into new memory. The arguments might refer to an element, so the new element
+         * is constructed before the current ones are moved.
+         */
+        template<typename... Args>
+        bool _growAndEmplace(FalseType, Args&&... args) {
+            counter_type new_cap = _grownCapacity();
+            pointer newData;
+            if (!_derived()._allocate(new_cap, newData)) {
+                return false;
+            }
+
+            steroido_intern::construct<T>(newData + _currentElementCount, steroido_intern::forward<Args>(args)...);
+            _moveTo(newData, new_cap);
+            return true;
+        }
+
+        /**
+         * Inserts count elements at the specified position, shifting the following elements only once.
+         * @param pos Position the elements will be placed.
+         * @param count Number of elements.
+         * @param source The elements, accessed with source[0] to source[count - 1].
+         * @return Position of the first inserted element, end() if they could not be inserted.
+         */
+        template<class Source>
+        iterator _insertN(iterator pos, counter_type count, const Source &source) {
+            if (pos > end()) {
+                return end();
+            }
+
+            counter_type index = pos - _begin;
+            if (!count) {
+                return pos;
+            }
+            if (!_reserveFor(_currentElementCount + count)) {
+                return end();
+            }
+
+            pointer place = _begin + index;
+            pointer oldEnd = end();
+            counter_type behind = _currentElementCount - index;
+
+            if (IsTriviallyCopyable<T>::value) {
+                memmove(static_cast<void*>(place + count), static_cast<const void*>(place), behind * sizeof(T));
+                for (counter_type i = 0; i < count; ++i) {
+                    steroido_intern::construct<T>(place + i, source[i]);
+                }
+            } else if (behind > count) {
+                // The last elements move into the uninitialized memory, the others are moved back by assignment
+                for (counter_type i = 0; i < count; ++i) {
+                    steroido_intern::construct<T>(oldEnd + i, steroido_intern::move(*(oldEnd - count + i)));
+                }
+                for (counter_type i = behind - count; i > 0; --i) {
+                    place[i - 1 + count] = steroido_intern::move(place[i - 1]);
+                }
+                for (counter_type i = 0; i < count; ++i) {
+                    place[i] = source[i];
+                }
+            } else {
+                // All following elements and some of the new ones go into the uninitialized memory
+                for (counter_type i = behind; i < count; ++i) {
+                    steroido_intern::construct<T>(place + i, source[i]);
+                }
+                for (counter_type i = 0; i < behind; ++i) {
+                    steroido_intern::construct<T>(place + count + i, steroido_intern::move(place[i]));
+                }
+                for (counter_type i = 0; i < behind; ++i) {
+                    place[i] = source[i];
+                }
+            }
+
+            _currentElementCount += count;
+            return place;
+        }
+
+        /**
+         * Destroys the elements from the given position on.
+         * @param count Number of elements to keep.
+         */
+        void _destroyFrom(counter_type count) {
+            steroido_intern::destroy(_begin + count, _currentElementCount - count);
+            _currentElementCount = count;
+        }
+
+        /**
+         * Makes sure the specified number of elements fits inside, grows by the usual factor at least.
+         * @param needed Number of elements.
+         * @return False if there was no memory for them.
+         */
+        bool _reserveFor(counter_type needed) {
+            if (needed <= _currentSize) {
+                return true;
+            }
+
+            counter_type new_cap = _grownCapacity();
+            return _changeCapacity(new_cap > needed ? new_cap : needed);
+        }
+
+        /**
+         * Changes the capacity to the specified size. The memory is resized in place if possible, otherwise the
+         * elements are moved into new memory.
+         * @param new_cap New capacity, must be at least the current element count.
+         * @return If the capacity could be changed.
+         */
+        bool _changeCapacity(counter_type new_cap) {
+            pointer newData = _begin;
+            if (_currentElementCount && _derived()._reallocate(newData, new_cap)) {
+                _begin = newData;
+                _currentSize = new_cap;
+                return true;
+            }
+
+            if (!_derived()._allocate(new_cap, newData)) {
+                return false;
+            }
+
+            _moveTo(newData, new_cap);
+            return true;
+        }
+
+        /**
+         * Moves the elements into the given memory and frees the current one.
+         * @param newData Memory for new_cap elements, may be the current one.
+         * @param new_cap Capacity of the memory.
+         */
+        void _moveTo(pointer newData, counter_type new_cap) {
+            if (newData != _begin) {
+                if (newData && _currentElementCount) {
+                    steroido_intern::relocate(newData, _begin, _currentElementCount);
+                }
+                _derived()._free(_begin);
+                _begin = newData;
+            }
+
+            _currentSize = new_cap;
+        }
+
+        /**
+         * Capacity to grow to if the vector is full.
+         * @return New capacity.
+         */
+        counter_type _grownCapacity() const {
+            if (_currentSize == 0) {
+                return VECTOR_AUTO_PRERESERVED_SPACE;
+            }
+            return (_currentSize * VECTOR_AUTO_RESERVE_MULTIPLICATOR) + VECTOR_AUTO_RESERVE_ADDITION;
+        }
+};
+
+}; // namespace steroido_intern
+
+#endif // VECTOR_BASE_H
@@ -0,0 +1,247 @@
+#ifndef WINDOW_STATISTICS_H
+#define WINDOW_STATISTICS_H
+
+#include <math.h>
+#include <stdint.h>
+#include "TypeTraits.h"
+#include "AdvancedCircularBuffer.h"
+
+namespace steroido_intern {
+    /**
+     * @brief Default type of the sum: integers of up to 16 bit are summed in 32 bit, so the sum of
+     * a window does not overflow
+     *
+     */
+    template<typename T>
+    struct WindowSumType {
+        typedef typename Conditional<IsIntegral<T>::value && sizeof(T) <= 2,
+            typename Conditional<IsSigned<T>::value, int32_t, uint32_t>::type, T>::type type;
+    };
+};
+
+/**
+ * @brief Statistics over the last WindowSize pushed values. Sum, mean and variance are updated
+ * incrementally, min and max are kept in monotonic deques, so every push is O(1) (amortized for
+ * min/max) instead of O(WindowSize). Once per WindowSize pushes, sum, mean and variance are
+ * recalculated from the window, so rounding errors of the incremental updates do not add up.
+ *
+ * @tparam T The Type of the values (integer or floating point)
+ * @tparam WindowSize The count of values the statistics are calculated over
+ * @tparam SumType The Type the sum is accumulated in, must hold WindowSize * the biggest value.
+ * Defaults to 32 bit for integers of up to 16 bit, T otherwise.
+ * @tparam RealType The Type mean and variance are calculated in
+ * @note Needs three times the memory of a single AdvancedCircularBuffer<T, WindowSize>. NaN values
+ * break min/max.
+ */
+template<typename T, size_t WindowSize, typename SumType = typename steroido_intern::WindowSumType<T>::type, typename RealType = float>
+class WindowStatistics {
+    public:
+        typedef AdvancedCircularBuffer<T, WindowSize> Window;
+
+        /**
+         * @brief Construct new, empty Window Statistics
+         *
+         */
+        WindowStatistics() : _sum(0), _mean(0), _m2(0), _replacements(0) {}
+
+        /**
+         * @brief Add a new value. If the window is full, the oldest value leaves the statistics.
+         *
+         * @param value
+         */
+        void push(const T &value) {
+            bool replace = _window.full();
+            if (replace) {
+                _replace(_window.getTailReference(), value);
+            } else {
+                _add(value);
+            }
+
+            _window.push(value);
+            if (replace && ++_replacements >= WindowSize) _recalculate();
+            _pushMonotonic(_minimums, value, true);
+            _pushMonotonic(_maximums, value, false);
+        }
+
+        /**
+         * @brief Returns the sum of all values in the window
+         *
+         * @return SumType
+         */
+        SumType sum() const {
+            return _sum;
+        }
+
+        /**
+         * @brief Returns the mean of all values in the window (0 if empty)
+         *
+         * @return RealType
+         */
+        RealType mean() const {
+            if (_window.empty()) return 0;
+            return (RealType)_sum / (RealType)_window.size();
+        }
+
+        /**
+         * @brief Returns the (population) variance of the values in the window (0 if empty)
+         *
+         * @return RealType
+         */
+        RealType variance() const {
+            if (_window.empty()) return 0;
+
+            // Rounding may push the sum of squares slightly below zero
+            RealType variance = _m2 / (RealType)_window.size();
+            return variance > 0 ? variance : 0;
+        }
+
+        /**
+         * @brief Returns the (population) standard deviation of the values in the window
+         *
+         * @return RealType
+         */
+        RealType standardDeviation() const {
+            return sqrt(variance());
+        }
+
+        /**
+         * @brief Returns the smallest value in the window (T() if empty)
+         *
+         * @return T
+         */
+        T min() const {
+            const T *oldest = _minimums.peek();
+            return oldest ? *oldest : T();
+        }
+
+        /**
+         * @brief Returns the biggest value in the window (T() if empty)
+         *
+         * @return T
+         */
+        T max() const {
+            const T *oldest = _maximums.peek();
+            return oldest ? *oldest : T();
+        }
+
+        /**
+         * @brief Returns the values currently in the window, e.g. to iterate over them
+         *
+         * @return const Window&
+         */
+        const Window& window() const {
+            return _window;
+        }
+
+        /**
+         * @brief Returns the count of values currently in the window
+         *
+         * @return size_t
+         */
+        size_t size() const {
+            return _window.size();
+        }
+
+        bool empty() const {
+            return _window.empty();
+        }
+
+        bool full() const {
+            return _window.full();
+        }
+
+        static constexpr size_t capacity() {
+            return WindowSize;
+        }
+
+        /**
+         * @brief Remove all values from the window
+         *
+         */
+        void reset() {
+            _window.reset();
+            _minimums.reset();
+            _maximums.reset();
+            _sum = 0;
+            _mean = 0;
+            _m2 = 0;
+            _replacements = 0;
+        }
+
+    private:
+        Window _window;
+
+        // Candidates for the min/max, the oldest one (tail) is the current min/max. Equal values are
+        // kept, so the leaving value can be identified by comparing it with the tail.
+        Window _minimums;
+        Window _maximums;
+
+        SumType _sum;
+
+        // Welford's running mean and sum of squared differences
+        RealType _mean;
+        RealType _m2;
+
+        // Incremental replacements since the last recalculation
+        size_t _replacements;
+
+        void _add(const T &value) {
+            _sum += value;
+
+            RealType delta = (RealType)value - _mean;
+            _mean += delta / (RealType)(_window.size() + 1);
+            _m2 += delta * ((RealType)value - _mean);
+        }
+
+        void _replace(const T &oldest, const T &value) {
+            _sum += value;
+            _sum -= oldest;
+
+            RealType oldMean = _mean;
+            _mean += ((RealType)value - (RealType)oldest) / (RealType)WindowSize;
+            _m2 += ((RealType)value - (RealType)oldest) *
+                   ((RealType)value - _mean + (RealType)oldest - oldMean);
+
+            // The oldest value leaves the min/max candidates if it is still in front
+            const T *minimum = _minimums.peek();
+            if (minimum && !(*minimum < oldest) && !(oldest < *minimum)) _minimums.dropLast();
+
+            const T *maximum = _maximums.peek();
+            if (maximum && !(*maximum < oldest) && !(oldest < *maximum)) _maximums.dropLast();
+        }
+
+        // Sum, mean and sum of squared differences exactly from the window again (two passes)
+        void _recalculate() {
+            _sum = 0;
+            for (const T &value : _window) _sum += value;
+            _mean = (RealType)_sum / (RealType)WindowSize;
+
+            _m2 = 0;
+            for (const T &value : _window) {
+                RealType delta = (RealType)value - _mean;
+                _m2 += delta * delta;
+            }
+
+            _replacements = 0;
+        }
+
+        /**
+         * @brief Drop all newer candidates which can never become the min/max again, then add the
+         * value as newest candidate
+         *
+         * @param deque
+         * @param value
+         * @param minimum true to keep the deque ascending (min), false for descending (max)
+         */
+        static void _pushMonotonic(Window &deque, const T &value, bool minimum) {
+            while (!deque.empty()) {
+                const T &newest = deque.getHeadReference();
+                if (minimum ? !(value < newest) : !(newest < value)) break;
+                deque.deleteAmountFromHead(1);
+            }
+
+            deque.push(value);
+        }
+};
+
+#endif // WINDOW_STATISTICS_H
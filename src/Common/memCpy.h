@@ -2,26 +2,42 @@
 #define MEMCPY_H
 
 #include <stddef.h>
+#include <string.h>
+#include "TypeTraits.h"
+
+namespace steroido_intern {
+    template<typename T>
+    inline void _memCpy(T* dest, const T* src, size_t count, TrueType) {
+        // The platform memmove copies whole words (and uses SIMD where available), overlapping
+        // ranges included
+        if (count) memmove(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
+    }
+
+    template<typename T>
+    inline void _memCpy(T* dest, const T* src, size_t count, FalseType) {
+        while (count--) *dest++ = *src++;
+    }
+};
 
 /**
- * @brief Copy elements from one location to another.
+ * @brief Copy elements from one location to another. Trivially copyable elements are copied
+ * with memmove, all others are assigned one by one.
  * 
  * @tparam T 
  * @param dest Destination of the copied data
  * @param src Source for the Data to be copied
  * @param count Count of elements to be copied (! NOT BYTES !)
- * @return T* Pointer to the Destination
+ * @return T* Pointer behind the last copied element in the Destination
  */
 template<typename T>
 T* memCpy(T* dest, const T* src, size_t count) {
-    while (count--)
-        *dest++ = *src++;
-    return dest;
+    steroido_intern::_memCpy(dest, src, count, steroido_intern::BoolConstant<steroido_intern::IsTriviallyCopyable<T>::value>());
+    return dest + count;
 }
 
 template <typename T>
 void memCpyN(T* dest, const T* src, size_t count) {
-    while (count--) *dest++ = *src++;
+    steroido_intern::_memCpy(dest, src, count, steroido_intern::BoolConstant<steroido_intern::IsTriviallyCopyable<T>::value>());
 }
 
 #endif // MEMCPY_H
@@ -2,21 +2,68 @@
 #define MEMSET_H
 
 #include <stddef.h>
+#include <string.h>
+#include "TypeTraits.h"
+
+namespace steroido_intern {
+    /**
+     * @brief Check if all bytes of a value are the same, so it can be set with memset
+     *
+     * @param value
+     * @param size in bytes
+     * @return true if all bytes equal the first one
+     */
+    inline bool _sameBytes(const void *value, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char*>(value);
+        for (size_t i = 1; i < size; i++) {
+            if (bytes[i] != bytes[0]) return false;
+        }
+        return true;
+    }
+
+    template<typename T>
+    inline void _memSet(T* dest, const T &val, size_t count, TrueType) {
+        // Single bytes and values like zero are set by the platform memset, short runs of
+        // bigger elements are faster with the loop below
+        if (count && (sizeof(T) == 1 || (count * sizeof(T) >= 64 && _sameBytes(&val, sizeof(T))))) {
+            memset(static_cast<void*>(dest), *reinterpret_cast<const unsigned char*>(&val), count * sizeof(T));
+            return;
+        }
+
+        // Set the first 64 bytes one by one, then double the already set part with memcpy
+        const size_t first = 64 / sizeof(T) > 1 ? 64 / sizeof(T) : 1;
+        size_t done = 0;
+        while (done < count && done < first)
+            dest[done++] = val;
+
+        while (done < count) {
+            size_t chunk = done < count - done ? done : count - done;
+            memcpy(static_cast<void*>(dest + done), static_cast<const void*>(dest), chunk * sizeof(T));
+            done += chunk;
+        }
+    }
+
+    template<typename T>
+    inline void _memSet(T* dest, const T &val, size_t count, FalseType) {
+        while (count-- > 0)
+            *dest++ = val;
+    }
+};
 
 /**
- * @brief Set a bunch of elements to a given value at once
+ * @brief Set a bunch of elements to a given value at once. Trivially copyable elements are set
+ * with memset if all their bytes are equal (e.g. zero) and memcpy otherwise, all others are assigned one by one.
  * 
  * @tparam T 
  * @param dest Destination of the set data
  * @param val The Value to be Set to all elements
  * @param count Count of elements to be set (! NOT BYTES !)
- * @return T* 
+ * @return T* Pointer behind the last set element
  */
 template<typename T>
 T* memSet(T* dest, T val, size_t count) {
-    while (count-- > 0)
-        *dest++ = val;
-    return dest;
+    steroido_intern::_memSet(dest, val, count, steroido_intern::BoolConstant<steroido_intern::IsTriviallyCopyable<T>::value>());
+    return dest + count;
 }
 
-#endif
\ No newline at end of file
+#endif // MEMSET_H
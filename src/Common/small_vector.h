@@ -0,0 +1,110 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "VectorBase.h"
+
+/**
+ * Vector storing up to N elements inside itself. Only if more elements are added, the elements move to
+ * the heap (or the Steroido pool), so small containers never touch the allocator. Same interface as vector.
+ * @tparam T Type of the elements.
+ * @tparam N Count of elements stored inline.
+ * @tparam counter_type Type the elements are counted with.
+ */
+template<class T, unsigned int N, typename counter_type = unsigned int>
+class small_vector : public steroido_intern::VectorBase<T, counter_type, small_vector<T, N, counter_type>> {
+    static_assert(N > 0, "small_vector needs at least one inline element");
+
+    friend class steroido_intern::VectorBase<T, counter_type, small_vector<T, N, counter_type>>;
+
+    public:
+        using pointer = T*;
+
+        /**
+         * Creates a vector using the inline storage.
+         */
+        small_vector() {
+            this->_useStorage(_inlineData(), N);
+        }
+
+        /**
+         * Creates a vector with the given capacity.
+         * @param init_cap Number of elements, that should fit inside.
+         */
+        explicit small_vector(counter_type init_cap) : small_vector() {
+            this->reserve(init_cap);
+        }
+
+        /**
+         * Destructs this vector and releases memory.
+         */
+        ~small_vector() {
+            this->clear();
+        }
+
+        /**
+         * If the elements are currently stored inline.
+         * @return True if no heap memory is used.
+         */
+        bool is_inline() const noexcept {
+            return this->begin() == _inlineData();
+        }
+
+    private:
+        alignas(T) char _inline[N * sizeof(T)];
+
+        pointer _inlineData() {
+            return reinterpret_cast<pointer>(_inline);
+        }
+
+        const T* _inlineData() const {
+            return reinterpret_cast<const T*>(_inline);
+        }
+
+        /**
+         * Uses the inline storage if the elements fit into it, the heap otherwise.
+         * @param new_cap Count of elements, at least N afterwards.
+         * @param data Pointer to the memory.
+         * @return False if there is no heap memory left.
+         */
+        bool _allocate(counter_type &new_cap, pointer &data) {
+            if (new_cap <= N) {
+                new_cap = N;
+                data = _inlineData();
+            } else {
+                data = this->_allocateRaw(new_cap);
+            }
+            return data != nullptr;
+        }
+
+        /**
+         * Resizes heap memory in place if possible, only for trivially copyable elements.
+         * @param data Pointer to the memory, the resized memory afterwards.
+         * @param new_cap Count of elements.
+         * @return False if the elements have to be moved into new memory (e.g. to or from the inline storage).
+         */
+        bool _reallocate(pointer &data, counter_type &new_cap) {
+            if (data == _inlineData() || new_cap <= N) {
+                return false;
+            }
+
+            pointer resized = this->_reallocateRaw(data, new_cap);
+            if (!resized) {
+                return false;
+            }
+
+            data = resized;
+            return true;
+        }
+
+        /**
+         * Frees memory of _allocate().
+         * @param data Pointer to the memory.
+         */
+        void _free(pointer data) {
+            if (data != _inlineData()) {
+                this->_freeRaw(data);
+            }
+        }
+};
+
+#endif // SMALL_VECTOR_H
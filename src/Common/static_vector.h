@@ -0,0 +1,195 @@
+#ifndef STATIC_VECTOR_H
+#define STATIC_VECTOR_H
+
+#include "VectorBase.h"
+
+/**
+ * Vector with a fixed capacity of N elements stored inside itself, it never uses the heap. Same interface
+ * as vector, but adding elements to a full static_vector fails and reports it instead of reallocating.
+ * @tparam T Type of the elements.
+ * @tparam N Maximum count of elements.
+ * @tparam counter_type Type the elements are counted with.
+ */
+template<class T, unsigned int N, typename counter_type = unsigned int>
+class static_vector : public steroido_intern::VectorBase<T, counter_type, static_vector<T, N, counter_type>> {
+    static_assert(N > 0, "static_vector needs a capacity of at least one element");
+
+    friend class steroido_intern::VectorBase<T, counter_type, static_vector<T, N, counter_type>>;
+
+    public:
+        using pointer = T*;
+        using iterator = pointer;
+
+        /**
+         * Creates an empty vector.
+         */
+        static_vector() {
+            this->_useStorage(_storageData(), N);
+        }
+
+        /**
+         * Destructs all elements.
+         */
+        ~static_vector() {
+            this->clear();
+        }
+
+        /**
+         * If no more elements can be added.
+         * @return If full.
+         */
+        bool full() const noexcept {
+            return this->size() == N;
+        }
+
+        /**
+         * Inserts an element at the end.
+         * @param value Element to insert.
+         * @return False if the vector is full.
+         */
+        bool push_back(const T& value) {
+            return this->_emplaceBack(value) != nullptr;
+        }
+
+        /**
+         * Inserts an element at the end.
+         * @param value Element to insert, will be moved.
+         * @return False if the vector is full.
+         */
+        bool push_back(T&& value) {
+            return this->_emplaceBack(steroido_intern::move(value)) != nullptr;
+        }
+
+        /**
+         * Constructs an element in place at the end.
+         * @param args Arguments for the constructor of the element.
+         * @return False if the vector is full.
+         */
+        template<typename... Args>
+        bool emplace_back(Args&&... args) {
+            return this->_emplaceBack(steroido_intern::forward<Args>(args)...) != nullptr;
+        }
+
+        /**
+         * Inserts an element at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed.
+         * @param value Element itself.
+         * @return Position of the inserted element, end() if the vector is full.
+         */
+        iterator insert(iterator pos, const T& value) {
+            return this->_emplace(pos, value);
+        }
+
+        /**
+         * Inserts an element at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed.
+         * @param value Element itself.
+         * @return Position of the inserted element, end() if the vector is full.
+         */
+        iterator insert(iterator pos, T&& value) {
+            return this->_emplace(pos, steroido_intern::move(value));
+        }
+
+        /**
+         * Inserts count copies of an element at the specified position, shifting the following elements only once.
+         * @param pos Position the elements will be placed.
+         * @param count Number of elements.
+         * @param value Element to be copied.
+         * @return Position of the first inserted element, end() if they do not fit, nothing is inserted then.
+         */
+        iterator insert(iterator pos, counter_type count, const T& value) {
+            return steroido_intern::VectorBase<T, counter_type, static_vector<T, N, counter_type>>::insert(pos, count, value);
+        }
+
+        /**
+         * Inserts copies of the elements of an array at the specified position, shifting the following elements
+         * only once. The array must not be part of this vector.
+         * @param pos Position the elements will be placed.
+         * @param first First element of the array.
+         * @param last Position after the last element of the array.
+         * @return Position of the first inserted element, end() if they do not fit, nothing is inserted then.
+         */
+        iterator insert(iterator pos, const T* first, const T* last) {
+            return steroido_intern::VectorBase<T, counter_type, static_vector<T, N, counter_type>>::insert(pos, first, last);
+        }
+
+        /**
+         * Constructs an element in place at the specified position.
+         * Elements at or behind that position will be shifted back.
+         * @param pos Position the element will be placed, end() appends it.
+         * @param args Arguments for the constructor of the element.
+         * @return Position of the inserted element, end() if the vector is full.
+         */
+        template<typename... Args>
+        iterator emplace(iterator pos, Args&&... args) {
+            return this->_emplace(pos, steroido_intern::forward<Args>(args)...);
+        }
+
+        /**
+         * Changes the number of elements, new ones are default constructed.
+         * @param count New number of elements.
+         * @return False if more than N elements were requested.
+         */
+        bool resize(counter_type count) {
+            return this->_resize(count);
+        }
+
+        /**
+         * Changes the number of elements, new ones are copies of value.
+         * @param count New number of elements.
+         * @param value Element to be copied.
+         * @return False if more than N elements were requested.
+         */
+        bool resize(counter_type count, const T& value) {
+            return this->_resize(count, value);
+        }
+
+        /**
+         * Replaces all elements with count copies of value.
+         * @param count New number of elements.
+         * @param value Element to be copied.
+         * @return False if more than N elements were requested, the vector is empty then.
+         */
+        bool assign(counter_type count, const T& value) {
+            return this->_assign(count, value);
+        }
+
+        /**
+         * Replaces all elements with copies of the elements of an array. The array must not be part of this vector.
+         * @param first First element of the array.
+         * @param last Position after the last element of the array.
+         * @return False if more than N elements were requested, the vector is empty then.
+         */
+        bool assign(const T* first, const T* last) {
+            return this->_assign(first, last);
+        }
+
+    private:
+        alignas(T) char _storage[N * sizeof(T)];
+
+        pointer _storageData() {
+            return reinterpret_cast<pointer>(_storage);
+        }
+
+        /**
+         * There is only the own storage.
+         * @param new_cap Count of elements, N afterwards.
+         * @param data Pointer to the storage.
+         * @return False if more than N elements were requested.
+         */
+        bool _allocate(counter_type &new_cap, pointer &data) {
+            if (new_cap > N) {
+                return false;
+            }
+
+            new_cap = N;
+            data = _storageData();
+            return true;
+        }
+
+        void _free(pointer) {}
+};
+
+#endif // STATIC_VECTOR_H
@@ -0,0 +1,166 @@
+#ifndef BUFFERED_OUTPUT_H
+#define BUFFERED_OUTPUT_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include "Common/NonCopyable.h"
+#include "Common/CircularBuffer.h"
+#include "Common/StaticFormat.h"
+#include "OS/ICallable.h"
+#include "IByteSink.h"
+
+namespace steroido_intern {
+    // Free segments of the output buffer, printf writes the characters directly into them
+    struct BufferedOutputTarget {
+        BufferSegment<uint8_t, uint16_t> first;
+        BufferSegment<uint8_t, uint16_t> second;
+    };
+
+    // maxlen is one more than the free space, so the terminating zero never overwrites a character
+    inline void _outBufferedOutput(char character, void *buffer, size_t idx, size_t maxlen) {
+        if (idx + 1 >= maxlen) return;
+
+        BufferedOutputTarget *target = static_cast<BufferedOutputTarget*>(buffer);
+        if (idx < target->first.length) {
+            target->first.data[idx] = character;
+        } else {
+            target->second.data[idx - target->first.length] = character;
+        }
+    }
+};
+
+/**
+ * @brief Text output which never blocks: print() and write() only put the text into a buffer,
+ * which is drained into a IByteSink (e.g. a SerialByteSink) as fast as it accepts the bytes. Add it
+ * to the Scheduler to drain it in the background.
+ *
+ * A message which does not fit into the buffer anymore is dropped as a whole (never cut off) and
+ * counted in overflowCount().
+ *
+ * @tparam BufferSize Size of the buffer in bytes
+ * @note print()/write() and drain() must be called from the same context (e.g. not print() in an interrupt)
+ */
+template<uint16_t BufferSize = 256>
+class BufferedOutput : public ICallable {
+    public:
+        /**
+         * @brief Construct a new Buffered Output
+         *
+         * @param sink The sink the text gets written to
+         */
+        BufferedOutput(IByteSink &sink) : _sink(sink) {}
+
+        /**
+         * @brief Format a message into the buffer, same as printf
+         *
+         * @param format printf format string
+         * @param ... Arguments for the format
+         * @return int Count of characters stored, -1 if the message got dropped
+         */
+        int print(const char *format, ...) {
+            va_list va;
+            va_start(va, format);
+            int ret = vprint(format, va);
+            va_end(va);
+            return ret;
+        }
+
+        int vprint(const char *format, va_list va) {
+            steroido_intern::BufferedOutputTarget target;
+            uint16_t freeSpace = _buffer.writeSegments(target.first, target.second);
+
+            int length = _vsnprintf(steroido_intern::_outBufferedOutput, reinterpret_cast<char*>(&target), freeSpace + 1, format, va);
+            return _commit(length, freeSpace);
+        }
+
+        /**
+         * @brief Format a message into the buffer, with the format parsed at compile time
+         *
+         * @param format STEROIDO_FORMAT("...")
+         * @param args Arguments for the conversions of the format, checked at compile time
+         * @return int Count of characters stored, -1 if the message got dropped
+         */
+        template<class Literal, typename... Args>
+        int print(StaticFormat<Literal>, const Args&... args) {
+            steroido_intern::BufferedOutputTarget target;
+            uint16_t freeSpace = _buffer.writeSegments(target.first, target.second);
+
+            size_t length = steroido_intern::formatStatic<Literal>(steroido_intern::_outBufferedOutput, reinterpret_cast<char*>(&target), freeSpace + 1, args...);
+            return _commit(length, freeSpace);
+        }
+
+        /**
+         * @brief Put text into the buffer
+         *
+         * @param data
+         * @param length Count of characters
+         * @return true if the text got stored
+         * @return false if it did not fit, nothing got stored
+         */
+        bool write(const char *data, uint16_t length) {
+            if (length > _buffer.leftCapacity()) {
+                _overflowCount++;
+                return false;
+            }
+            _buffer.push(reinterpret_cast<const uint8_t*>(data), length);
+            return true;
+        }
+
+        bool write(char character) {
+            return write(&character, 1);
+        }
+
+        /**
+         * @brief Write buffered text to the sink, as much as it takes without blocking
+         *
+         * @param maxBytes Maximum count of bytes to write
+         * @return uint16_t Count of bytes written
+         */
+        uint16_t drain(uint16_t maxBytes = BufferSize) {
+            return drainToSink(_buffer, _sink, maxBytes);
+        }
+
+        /**
+         * @brief Drain the buffer, so the output can be added to the Scheduler
+         *
+         */
+        void call() override {
+            drain();
+        }
+
+        /**
+         * @brief Returns the count of bytes waiting to be drained
+         *
+         * @return uint16_t
+         */
+        uint16_t pending() const {
+            return _buffer.size();
+        }
+
+        /**
+         * @brief Returns the count of messages dropped because the buffer was full
+         *
+         * @return uint32_t
+         */
+        uint32_t overflowCount() const {
+            return _overflowCount;
+        }
+
+    private:
+        IByteSink &_sink;
+        CircularBuffer<uint8_t, BufferSize, uint16_t, RejectNewest> _buffer;
+        uint32_t _overflowCount = 0;
+
+        // Keep a formatted message if it fit completely
+        int _commit(size_t length, uint16_t freeSpace) {
+            if (length > freeSpace) {
+                _overflowCount++;
+                return -1;
+            }
+
+            _buffer.commit(length);
+            return (int)length;
+        }
+};
+
+#endif // BUFFERED_OUTPUT_H
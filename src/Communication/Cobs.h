@@ -0,0 +1,82 @@
+#ifndef COBS_H
+#define COBS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Consistent Overhead Byte Stuffing: the encoded data contains no zero byte, so a zero can
+    separate the frames of a stream. A receiver joining in the middle, or after a lost byte, syncs
+    up again at the next zero. The overhead is 1 byte per started 254 bytes.
+*/
+
+/**
+ * @brief Maximum length of length bytes after cobsEncode() (without the separating zero)
+ *
+ */
+constexpr size_t cobsMaxEncodedLength(size_t length) {
+    return length + length / 254 + 1;
+}
+
+/**
+ * @brief Encode data with COBS
+ *
+ * @param data
+ * @param length Count of bytes
+ * @param encoded Place for the encoded bytes, at least cobsMaxEncodedLength(length) bytes
+ * @return size_t Count of encoded bytes
+ */
+inline size_t cobsEncode(const uint8_t *data, size_t length, uint8_t *encoded) {
+    size_t codeIndex = 0;
+    size_t position = 1;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < length; i++) {
+        if (data[i]) {
+            encoded[position++] = data[i];
+            code++;
+        }
+
+        if (!data[i] || code == 0xFF) {
+            encoded[codeIndex] = code;
+            codeIndex = position++;
+            code = 1;
+        }
+    }
+
+    encoded[codeIndex] = code;
+    return position;
+}
+
+/**
+ * @brief Decode a frame encoded with COBS (without the separating zero)
+ *
+ * @param encoded
+ * @param length Count of encoded bytes
+ * @param data Place for the decoded bytes
+ * @param maxLength Size of data
+ * @return size_t Count of decoded bytes, 0 if the frame is invalid or does not fit
+ */
+inline size_t cobsDecode(const uint8_t *encoded, size_t length, uint8_t *data, size_t maxLength) {
+    size_t position = 0;
+    size_t i = 0;
+
+    while (i < length) {
+        uint8_t code = encoded[i++];
+        if (!code || (size_t)(code - 1) > length - i || (size_t)(code - 1) > maxLength - position) return 0;
+
+        for (uint8_t j = 1; j < code; j++) {
+            if (!encoded[i]) return 0;
+            data[position++] = encoded[i++];
+        }
+
+        if (code != 0xFF && i < length) {
+            if (position >= maxLength) return 0;
+            data[position++] = 0;
+        }
+    }
+
+    return position;
+}
+
+#endif // COBS_H
@@ -0,0 +1,370 @@
+#ifndef DEFERRED_LOGGER_H
+#define DEFERRED_LOGGER_H
+
+#include <stdint.h>
+#include <string.h>
+#include "Common/NonCopyable.h"
+#include "Common/CircularBuffer.h"
+#include "Common/Crc16.h"
+#include "OS/ICallable.h"
+#include "Cobs.h"
+#include "IByteSink.h"
+
+// Longer string arguments get truncated
+#ifndef STEROIDO_DEFERRED_LOG_STRING_LENGTH
+    #define STEROIDO_DEFERRED_LOG_STRING_LENGTH 32
+#endif
+
+// All format strings are sent again after this many messages, so a host connecting later learns them, 0 = never
+#ifndef STEROIDO_DEFERRED_LOG_RESEND_INTERVAL
+    #define STEROIDO_DEFERRED_LOG_RESEND_INTERVAL 256
+#endif
+
+/*
+    Binary log format, decoded on the host with tools/decode_deferred_log.py. Every record is
+
+        uint8_t type, payload, uint16_t CRC-16/CCITT-FALSE of type and payload
+
+    COBS encoded and followed by a zero byte (the same framing as the Telemetry). All values are
+    little endian:
+        'F' format:  uint32_t id, the format string (without terminating zero)
+        'M' message: uint32_t id of the format, the arguments as uint8_t type + value
+        'D' dropped: uint32_t count of messages dropped since the last record
+
+    The argument types are the Python struct codes b/B/h/H/i/I/q/Q/f/d of the value, c for a char
+    and s for a string (uint8_t length + characters).
+*/
+
+/**
+ * @brief Types of the records written by the DeferredLogger
+ *
+ */
+enum DeferredLogRecord : uint8_t {
+    DeferredLogFormat = 'F',
+    DeferredLogMessage = 'M',
+    DeferredLogDropped = 'D'
+};
+
+namespace steroido_intern {
+    /**
+     * @brief Writes COBS encoded records with CRC into the free segments of the log buffer, byte by
+     * byte, so no record has to be put together on the stack first
+     *
+     */
+    struct DeferredLogWriter {
+        BufferSegment<uint8_t, uint16_t> first;
+        BufferSegment<uint8_t, uint16_t> second;
+        uint16_t position;
+        uint16_t codePosition;
+        uint8_t code;
+        uint16_t crc;
+
+        void begin(uint8_t type) {
+            codePosition = position++;
+            code = 1;
+            crc = 0xFFFF;
+            put(type);
+        }
+
+        void put(const void *data, uint16_t length) {
+            const uint8_t *bytes = static_cast<const uint8_t*>(data);
+            crc = crc16(bytes, length, crc);
+            for (uint16_t i = 0; i < length; i++) _encode(bytes[i]);
+        }
+
+        void put(uint8_t byte) {
+            put(&byte, 1);
+        }
+
+        void end() {
+            _encode(crc & 0xFF);
+            _encode(crc >> 8);
+            _at(codePosition) = code;
+            _at(position++) = 0;
+        }
+
+        uint8_t& _at(uint16_t index) {
+            return index < first.length ? first.data[index] : second.data[index - first.length];
+        }
+
+        void _encode(uint8_t byte) {
+            if (byte) {
+                _at(position++) = byte;
+                code++;
+            }
+
+            if (!byte || code == 0xFF) {
+                _at(codePosition) = code;
+                codePosition = position++;
+                code = 1;
+            }
+        }
+    };
+
+    // Size of a record with the given payload length in the buffer
+    constexpr uint16_t deferredLogRecordSize(uint16_t payloadLength) {
+        return cobsMaxEncodedLength(1 + payloadLength + 2) + 1;
+    }
+
+    /**
+     * @brief Struct code of an integer by its size and signedness
+     *
+     */
+    template<typename T>
+    constexpr uint8_t deferredLogIntegerType() {
+        return T(-1) < T(0)
+            ? (sizeof(T) == 1 ? 'b' : sizeof(T) == 2 ? 'h' : sizeof(T) == 4 ? 'i' : 'q')
+            : (sizeof(T) == 1 ? 'B' : sizeof(T) == 2 ? 'H' : sizeof(T) == 4 ? 'I' : 'Q');
+    }
+
+    inline uint8_t deferredLogStringLength(const char *value) {
+        uint8_t length = 0;
+        if (value) {
+            while (length < STEROIDO_DEFERRED_LOG_STRING_LENGTH && value[length]) length++;
+        }
+        return length;
+    }
+
+    // Size of an argument in the record (type + value)
+    template<typename T>
+    inline uint16_t deferredLogSize(T) {
+        static_assert(sizeof(T) <= 8, "Unsupported argument type for the DeferredLogger");
+        return 1 + sizeof(T);
+    }
+
+    template<typename T>
+    inline uint16_t deferredLogSize(T*) {
+        return 1 + sizeof(uintptr_t);
+    }
+
+    inline uint16_t deferredLogSize(const char *value) {
+        return 2 + deferredLogStringLength(value);
+    }
+
+    inline uint16_t deferredLogSize(char *value) {
+        return deferredLogSize(static_cast<const char*>(value));
+    }
+
+    // Write an argument into the record
+    template<typename T>
+    inline void deferredLogWrite(DeferredLogWriter &writer, T value) {
+        writer.put(deferredLogIntegerType<T>());
+        writer.put(&value, sizeof(T));
+    }
+
+    inline void deferredLogWrite(DeferredLogWriter &writer, char value) {
+        writer.put('c');
+        writer.put(static_cast<uint8_t>(value));
+    }
+
+    inline void deferredLogWrite(DeferredLogWriter &writer, float value) {
+        writer.put('f');
+        writer.put(&value, sizeof(value));
+    }
+
+    inline void deferredLogWrite(DeferredLogWriter &writer, double value) {
+        // double is only 4 bytes on AVR
+        writer.put(sizeof(double) == sizeof(float) ? 'f' : 'd');
+        writer.put(&value, sizeof(value));
+    }
+
+    template<typename T>
+    inline void deferredLogWrite(DeferredLogWriter &writer, T *value) {
+        deferredLogWrite(writer, reinterpret_cast<uintptr_t>(value));
+    }
+
+    inline void deferredLogWrite(DeferredLogWriter &writer, const char *value) {
+        uint8_t length = deferredLogStringLength(value);
+        writer.put('s');
+        writer.put(length);
+        writer.put(value, length);
+    }
+
+    inline void deferredLogWrite(DeferredLogWriter &writer, char *value) {
+        deferredLogWrite(writer, static_cast<const char*>(value));
+    }
+
+    inline uint16_t deferredLogArgumentsSize() {
+        return 0;
+    }
+
+    template<typename T, typename... Args>
+    inline uint16_t deferredLogArgumentsSize(T value, Args... args) {
+        return deferredLogSize(value) + deferredLogArgumentsSize(args...);
+    }
+
+    inline void deferredLogWriteArguments(DeferredLogWriter&) {}
+
+    template<typename T, typename... Args>
+    inline void deferredLogWriteArguments(DeferredLogWriter &writer, T value, Args... args) {
+        deferredLogWrite(writer, value);
+        deferredLogWriteArguments(writer, args...);
+    }
+};
+
+/**
+ * @brief Logger which does not format anything on the target. A message only stores the address
+ * of its format string and the raw arguments into a buffer, each format string itself is sent on
+ * its first use and again every STEROIDO_DEFERRED_LOG_RESEND_INTERVAL messages. The records are
+ * checked by a CRC and framed with COBS, so the host syncs up again after lost bytes. The buffer is
+ * drained into a IByteSink in the background (add the logger to the Scheduler), the text is
+ * reconstructed on the host by tools/decode_deferred_log.py.
+ *
+ * @tparam BufferSize Size of the buffer in bytes
+ * @tparam FormatCount Count of format strings remembered as sent, further ones replace the oldest
+ * (which then get sent again on their next use)
+ * @note log() and drain() must be called from the same context (e.g. not log() in an interrupt)
+ */
+template<uint16_t BufferSize = 256, uint8_t FormatCount = 16>
+class DeferredLogger : public ICallable {
+    static_assert(FormatCount > 0 && FormatCount < 128, "FormatCount must be between 1 and 127");
+
+    public:
+        /**
+         * @brief Construct a new Deferred Logger
+         *
+         * @param sink The sink the log gets written to
+         */
+        DeferredLogger(IByteSink &sink) : _sink(sink) {}
+
+        /**
+         * @brief Log a message. Same as printf, but the text is formatted on the host later.
+         *
+         * @param format printf format string, must stay valid (a string literal)
+         * @param args Arguments for the format: integers, floats, chars, strings and pointers
+         * @return true if the message got stored
+         * @return false if the buffer is full, the message got dropped
+         */
+        template<typename... Args>
+        bool log(const char *format, Args... args) {
+            using steroido_intern::deferredLogRecordSize;
+
+            #if STEROIDO_DEFERRED_LOG_RESEND_INTERVAL > 0
+                if (_sinceResend >= STEROIDO_DEFERRED_LOG_RESEND_INTERVAL) resendFormats();
+            #endif
+
+            int8_t formatSlot = _findFormat(format);
+            uint16_t formatLength = 0;
+            if (formatSlot < 0) {
+                size_t length = strlen(format);
+                formatLength = length > 251 ? 251 : length;
+            }
+
+            uint16_t needed = deferredLogRecordSize(4 + steroido_intern::deferredLogArgumentsSize(args...));
+            if (formatSlot < 0) needed += deferredLogRecordSize(4 + formatLength);
+            if (_pendingDrops) needed += deferredLogRecordSize(4);
+
+            if (needed > _buffer.leftCapacity()) {
+                _pendingDrops++;
+                _dropCount++;
+                return false;
+            }
+
+            steroido_intern::DeferredLogWriter writer;
+            _buffer.writeSegments(writer.first, writer.second);
+            writer.position = 0;
+
+            if (_pendingDrops) {
+                writer.begin(DeferredLogDropped);
+                writer.put(&_pendingDrops, 4);
+                writer.end();
+                _pendingDrops = 0;
+            }
+
+            uint32_t id = _id(format);
+            if (formatSlot < 0) {
+                writer.begin(DeferredLogFormat);
+                writer.put(&id, 4);
+                writer.put(format, formatLength);
+                writer.end();
+                _rememberFormat(format);
+            }
+
+            writer.begin(DeferredLogMessage);
+            writer.put(&id, 4);
+            steroido_intern::deferredLogWriteArguments(writer, args...);
+            writer.end();
+
+            _buffer.commit(writer.position);
+            _sinceResend++;
+            return true;
+        }
+
+        /**
+         * @brief Write buffered bytes to the sink, as many as it takes without blocking
+         *
+         * @param maxBytes Maximum count of bytes to write
+         * @return uint16_t Count of bytes written
+         */
+        uint16_t drain(uint16_t maxBytes = BufferSize) {
+            return drainToSink(_buffer, _sink, maxBytes);
+        }
+
+        /**
+         * @brief Drain the buffer, so the logger can be added to the Scheduler
+         *
+         */
+        void call() override {
+            drain();
+        }
+
+        /**
+         * @brief Send all format strings again on their next use, e.g. after the host reconnected
+         *
+         */
+        void resendFormats() {
+            _formatCount = 0;
+            _nextFormat = 0;
+            _sinceResend = 0;
+        }
+
+        /**
+         * @brief Returns the count of bytes waiting to be drained
+         *
+         * @return uint16_t
+         */
+        uint16_t pending() const {
+            return _buffer.size();
+        }
+
+        /**
+         * @brief Returns the count of messages dropped because the buffer was full
+         *
+         * @return uint32_t
+         */
+        uint32_t dropCount() const {
+            return _dropCount;
+        }
+
+    private:
+        IByteSink &_sink;
+        CircularBuffer<uint8_t, BufferSize, uint16_t, RejectNewest> _buffer;
+        const char *_formats[FormatCount];
+        uint8_t _formatCount = 0;
+        uint8_t _nextFormat = 0;
+        uint32_t _pendingDrops = 0;
+        uint32_t _dropCount = 0;
+        uint16_t _sinceResend = 0;
+
+        static uint32_t _id(const char *format) {
+            return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(format));
+        }
+
+        int8_t _findFormat(const char *format) const {
+            for (uint8_t i = 0; i < _formatCount; i++) {
+                if (_formats[i] == format) return i;
+            }
+            return -1;
+        }
+
+        void _rememberFormat(const char *format) {
+            if (_formatCount < FormatCount) {
+                _formats[_formatCount++] = format;
+            } else {
+                _formats[_nextFormat] = format;
+                _nextFormat = (_nextFormat + 1) % FormatCount;
+            }
+        }
+};
+
+#endif // DEFERRED_LOGGER_H
@@ -0,0 +1,54 @@
+#ifndef IBYTESINK_H
+#define IBYTESINK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Common/NonCopyable.h"
+
+/**
+ * @brief Interface for something bytes can be written to (e.g. a Serial), used to drain buffered
+ * output in the background
+ *
+ */
+class IByteSink : private NonCopyable<IByteSink> {
+    public:
+        /**
+         * @brief Write bytes without blocking
+         *
+         * @param data
+         * @param length Count of bytes
+         * @return size_t Count of bytes actually written (the rest has to be written later)
+         */
+        virtual size_t write(const uint8_t *data, size_t length) = 0;
+};
+
+/**
+ * @brief Write the content of a byte buffer (e.g. CircularBuffer<uint8_t, ...>) to a sink and
+ * release what got accepted, as much as the sink takes without blocking
+ *
+ * @tparam Buffer Buffer with readSegments() and release()
+ * @param buffer
+ * @param sink
+ * @param maxBytes Maximum count of bytes to write
+ * @return uint16_t Count of bytes written
+ */
+template<class Buffer>
+uint16_t drainToSink(Buffer &buffer, IByteSink &sink, uint16_t maxBytes) {
+    typename Buffer::Segment segments[2];
+    buffer.readSegments(segments[0], segments[1]);
+
+    uint16_t written = 0;
+    for (typename Buffer::Segment &segment : segments) {
+        uint16_t length = segment.length < maxBytes - written ? segment.length : maxBytes - written;
+        if (!length) break;
+
+        uint16_t accepted = sink.write(segment.data, length);
+        buffer.release(accepted);
+        written += accepted;
+        if (accepted < length) break;
+    }
+
+    return written;
+}
+
+#endif // IBYTESINK_H
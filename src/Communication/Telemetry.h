@@ -0,0 +1,273 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <string.h>
+#include "Common/NonCopyable.h"
+#include "Common/CircularBuffer.h"
+#include "Common/TypeTraits.h"
+#include "Common/Crc16.h"
+#include "OS/ICallable.h"
+#include "Cobs.h"
+#include "IByteSink.h"
+
+/*
+    Binary telemetry stream, decoded on the host with tools/decode_telemetry.py. Every frame is
+
+        uint8_t type, payload, uint16_t CRC-16/CCITT-FALSE of type and payload
+
+    COBS encoded and followed by a zero byte. All values are little endian:
+        'S' samples: uint8_t sequence number (counts every sample frame, a gap means lost frames),
+                     then records of uint8_t channel + the value in the type of the channel.
+                     Channel 0xFF is a uint32_t timestamp, valid for the following samples.
+        'C' channel: uint8_t channel, uint8_t type, the name (without terminating zero), sent before
+                     the first samples and again whenever the sequence number wraps around
+
+    The types are the Python struct codes b/B/h/H/i/I/q/Q/f/d of the value.
+*/
+
+/**
+ * @brief Types of the frames written by the Telemetry
+ *
+ */
+enum TelemetryFrame : uint8_t {
+    TelemetrySamples = 'S',
+    TelemetryChannelInfo = 'C'
+};
+
+/**
+ * @brief Channel number of the timestamp records, and of a channel which could not be added
+ *
+ */
+enum : uint8_t {
+    TelemetryTimestamp = 0xFF,
+    TelemetryNoChannel = 0xFE
+};
+
+/**
+ * @brief Handle of a telemetry channel, returned by Telemetry::addChannel()
+ *
+ * @tparam T Type of the samples
+ */
+template<typename T>
+struct TelemetryChannel {
+    explicit TelemetryChannel(uint8_t id = TelemetryNoChannel) : id(id) {}
+
+    uint8_t id;
+};
+
+namespace steroido_intern {
+    /**
+     * @brief Struct code of a sample type by its size and signedness
+     *
+     */
+    template<typename T>
+    constexpr uint8_t telemetryTypeCode() {
+        return IsFloatingPoint<T>::value
+            ? (sizeof(T) == 4 ? 'f' : 'd')
+            : IsSigned<T>::value
+                ? (sizeof(T) == 1 ? 'b' : sizeof(T) == 2 ? 'h' : sizeof(T) == 4 ? 'i' : 'q')
+                : (sizeof(T) == 1 ? 'B' : sizeof(T) == 2 ? 'H' : sizeof(T) == 4 ? 'I' : 'Q');
+    }
+};
+
+/**
+ * @brief Streams samples of typed channels as compact binary frames: many samples share one frame
+ * (1 byte channel + the raw value each), every frame is checked by a CRC and framed with COBS, so
+ * the host syncs up again after lost bytes. Channel names and types are sent before the first
+ * frame and again every 256 frames, for a host connecting later. The frames are
+ * buffered and drained into a IByteSink in the background (add the Telemetry to the Scheduler),
+ * the samples are decoded on the host by tools/decode_telemetry.py.
+ *
+ * A started frame is sent when it is full, on flush(), or by call() as soon as the output buffer
+ * is empty. So the frames get larger (less overhead) exactly when the connection is busy.
+ *
+ * @tparam MaxChannels Maximum count of channels
+ * @tparam FrameSize Maximum size of a frame in bytes (without the framing)
+ * @tparam BufferSize Size of the output buffer in bytes
+ * @note sample() and drain() must be called from the same context (e.g. not sample() in an interrupt)
+ */
+template<uint8_t MaxChannels = 16, uint8_t FrameSize = 64, uint16_t BufferSize = 256>
+class Telemetry : public ICallable {
+    static_assert(MaxChannels > 0 && MaxChannels < TelemetryNoChannel, "MaxChannels must be between 1 and 253");
+    static_assert(FrameSize >= 16 && FrameSize <= 254, "FrameSize must be between 16 and 254");
+    static_assert(BufferSize >= FrameSize + 2, "BufferSize must fit a framed frame");
+
+    public:
+        /**
+         * @brief Construct a new Telemetry
+         *
+         * @param sink The sink the frames get written to
+         */
+        Telemetry(IByteSink &sink) : _sink(sink) {}
+
+        /**
+         * @brief Add a channel
+         *
+         * @tparam T Type of the samples: an integer or floating point type
+         * @param name Name of the channel, must stay valid (a string literal)
+         * @return TelemetryChannel<T> The channel, invalid if MaxChannels are already added
+         */
+        template<typename T>
+        TelemetryChannel<T> addChannel(const char *name) {
+            static_assert(steroido_intern::IsIntegral<T>::value || steroido_intern::IsFloatingPoint<T>::value, "Telemetry samples must be integers or floating point values");
+            static_assert(sizeof(T) <= 8, "Unsupported sample type for the Telemetry");
+
+            if (_channelCount >= MaxChannels) return TelemetryChannel<T>();
+
+            _names[_channelCount] = name;
+            _types[_channelCount] = steroido_intern::telemetryTypeCode<T>();
+            return TelemetryChannel<T>(_channelCount++);
+        }
+
+        /**
+         * @brief Add a sample to the current frame
+         *
+         * @param channel
+         * @param value Converted to the type of the channel (e.g. a double for a float channel)
+         * @return true if the sample got added
+         * @return false if the channel is invalid
+         */
+        template<typename T>
+        bool sample(TelemetryChannel<T> channel, typename steroido_intern::TypeIdentity<T>::type value) {
+            if (channel.id >= _channelCount) return false;
+
+            uint8_t *record = _reserve(1 + sizeof(T));
+            record[0] = channel.id;
+            memcpy(record + 1, &value, sizeof(T));
+            return true;
+        }
+
+        /**
+         * @brief Add a timestamp to the current frame, the host assigns it to the following samples
+         *
+         * @param time e.g. micros() or millis()
+         */
+        void timestamp(uint32_t time) {
+            uint8_t *record = _reserve(1 + sizeof(time));
+            record[0] = TelemetryTimestamp;
+            memcpy(record + 1, &time, sizeof(time));
+        }
+
+        /**
+         * @brief Put the current frame into the output buffer, even if it is not full
+         *
+         */
+        void flush() {
+            if (!_frameLength) return;
+
+            _sendChannels();
+            if (!_send(_frame, _frameLength)) _droppedFrames++;
+
+            _frameLength = 0;
+            if (!++_sequence) resendChannels();
+        }
+
+        /**
+         * @brief Write buffered bytes to the sink, as many as it takes without blocking
+         *
+         * @param maxBytes Maximum count of bytes to write
+         * @return uint16_t Count of bytes written
+         */
+        uint16_t drain(uint16_t maxBytes = BufferSize) {
+            return drainToSink(_buffer, _sink, maxBytes);
+        }
+
+        /**
+         * @brief Flush the current frame if nothing else is waiting, then drain the buffer, so the
+         * telemetry can be added to the Scheduler
+         *
+         */
+        void call() override {
+            if (!_buffer.size()) flush();
+            drain();
+        }
+
+        /**
+         * @brief Send the names and types of all channels again, e.g. after the host reconnected
+         *
+         */
+        void resendChannels() {
+            _sentChannels = 0;
+        }
+
+        /**
+         * @brief Returns the count of bytes waiting to be drained
+         *
+         * @return uint16_t
+         */
+        uint16_t pending() const {
+            return _buffer.size();
+        }
+
+        /**
+         * @brief Returns the count of sample frames dropped because the buffer was full
+         *
+         * @return uint32_t
+         */
+        uint32_t droppedFrames() const {
+            return _droppedFrames;
+        }
+
+    private:
+        IByteSink &_sink;
+        CircularBuffer<uint8_t, BufferSize, uint16_t, RejectNewest> _buffer;
+        const char *_names[MaxChannels];
+        uint8_t _types[MaxChannels];
+        uint8_t _channelCount = 0;
+        uint8_t _sentChannels = 0;
+
+        uint8_t _frame[FrameSize];
+        uint8_t _frameLength = 0;
+        uint8_t _sequence = 0;
+        uint32_t _droppedFrames = 0;
+
+        // Place for a record in the current frame, sends the frame first if the record does not fit
+        uint8_t* _reserve(uint8_t length) {
+            if (_frameLength + length > FrameSize - 2) flush();
+
+            if (!_frameLength) {
+                _frame[0] = TelemetrySamples;
+                _frame[1] = _sequence;
+                _frameLength = 2;
+            }
+
+            uint8_t *record = _frame + _frameLength;
+            _frameLength += length;
+            return record;
+        }
+
+        // Send the channels added since the last frame, before the samples referring to them
+        void _sendChannels() {
+            while (_sentChannels < _channelCount) {
+                uint8_t frame[FrameSize];
+                size_t nameLength = strlen(_names[_sentChannels]);
+                if (nameLength > FrameSize - 5) nameLength = FrameSize - 5;
+
+                frame[0] = TelemetryChannelInfo;
+                frame[1] = _sentChannels;
+                frame[2] = _types[_sentChannels];
+                memcpy(frame + 3, _names[_sentChannels], nameLength);
+
+                if (!_send(frame, 3 + nameLength)) return;
+                _sentChannels++;
+            }
+        }
+
+        // Add the CRC, encode the frame and put it into the buffer, if it fits
+        bool _send(uint8_t *frame, uint8_t length) {
+            uint16_t crc = crc16(frame, length);
+            frame[length++] = crc & 0xFF;
+            frame[length++] = crc >> 8;
+
+            uint8_t encoded[cobsMaxEncodedLength(FrameSize) + 1];
+            uint16_t encodedLength = cobsEncode(frame, length, encoded);
+            encoded[encodedLength++] = 0;
+
+            if (encodedLength > _buffer.leftCapacity()) return false;
+            _buffer.push(encoded, encodedLength);
+            return true;
+        }
+};
+
+#endif // TELEMETRY_H
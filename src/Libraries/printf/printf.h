@@ -364,6 +364,58 @@ static size_t _ntoa_format(out_fct_type out, char* buffer, size_t idx, size_t ma
 }
 
 
+// two decimal digits for each value 0..99, so a number is converted with one division by 100 per
+// two digits (a division by a constant, which the compiler turns into a multiplication)
+static const char _digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+
+// internal decimal utoa, appends the digits reversed to buf, at least min_digits (zero padded)
+// \return The new length of buf
+static inline size_t _utoa_rev(char* buf, size_t len, size_t size, uint32_t value, unsigned int min_digits)
+{
+  const size_t end = len + min_digits;
+  while ((value >= 100U) && (len + 2U <= size)) {
+    const char* pair = &_digit_pairs[(value % 100U) * 2U];
+    value /= 100U;
+    buf[len++] = pair[1];
+    buf[len++] = pair[0];
+  }
+  if ((value >= 10U) && (len + 2U <= size)) {
+    buf[len++] = _digit_pairs[value * 2U + 1U];
+    buf[len++] = _digit_pairs[value * 2U];
+  }
+  else if ((value < 10U) && (len < size)) {
+    buf[len++] = (char)('0' + value);
+  }
+  while ((len < end) && (len < size)) {
+    buf[len++] = '0';
+  }
+  return len;
+}
+
+
+// internal decimal utoa for 64 bit values, one 64 bit division per 8 digits and the rest in 32 bit
+static inline size_t _utoa_rev_long_long(char* buf, size_t len, size_t size, unsigned long long value)
+{
+  while (value > 0xFFFFFFFFULL) {
+    const unsigned long long upper = value / 100000000ULL;
+    len = _utoa_rev(buf, len, size, (uint32_t)(value - upper * 100000000ULL), 8U);
+    value = upper;
+  }
+  return _utoa_rev(buf, len, size, (uint32_t)value, 1U);
+}
+
+
 // internal itoa for 'long' type
 static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxlen, unsigned long value, bool negative, unsigned long base, unsigned int prec, unsigned int width, unsigned int flags)
 {
@@ -377,11 +429,19 @@ static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxl
 
   // write if precision != 0 and value is != 0
   if (!(flags & FLAGS_PRECISION) || value) {
-    do {
-      const char digit = (char)(value % base);
-      buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
-      value /= base;
-    } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+    if (base == 10U) {
+      len = (value > 0xFFFFFFFFUL) ? _utoa_rev_long_long(buf, len, PRINTF_NTOA_BUFFER_SIZE, value) : _utoa_rev(buf, len, PRINTF_NTOA_BUFFER_SIZE, (uint32_t)value, 1U);
+    }
+    else {
+      // the other bases are powers of 2
+      const unsigned int shift = (base == 16U) ? 4U : (base == 8U) ? 3U : 1U;
+      const char letter = (flags & FLAGS_UPPERCASE ? 'A' : 'a') - 10;
+      do {
+        const char digit = (char)(value & (base - 1U));
+        buf[len++] = digit < 10 ? '0' + digit : letter + digit;
+        value >>= shift;
+      } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+    }
   }
 
   return _ntoa_format(out, buffer, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
@@ -402,11 +462,19 @@ static size_t _ntoa_long_long(out_fct_type out, char* buffer, size_t idx, size_t
 
   // write if precision != 0 and value is != 0
   if (!(flags & FLAGS_PRECISION) || value) {
-    do {
-      const char digit = (char)(value % base);
-      buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
-      value /= base;
-    } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+    if (base == 10U) {
+      len = _utoa_rev_long_long(buf, len, PRINTF_NTOA_BUFFER_SIZE, value);
+    }
+    else {
+      // the other bases are powers of 2
+      const unsigned int shift = (base == 16U) ? 4U : (base == 8U) ? 3U : 1U;
+      const char letter = (flags & FLAGS_UPPERCASE ? 'A' : 'a') - 10;
+      do {
+        const char digit = (char)(value & (base - 1U));
+        buf[len++] = digit < 10 ? '0' + digit : letter + digit;
+        value >>= shift;
+      } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+    }
   }
 
   return _ntoa_format(out, buffer, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
@@ -422,15 +490,35 @@ static size_t _etoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, d
 #endif
 
 
+// internal split of a positive, finite value into mantissa * 2^-shift (IEEE 754 single or double)
+static inline void _ftoa_split(double value, unsigned long long* mantissa, int* shift)
+{
+#if DBL_MANT_DIG == 24
+  // double is a single precision float (e.g. AVR)
+  union { double value; uint32_t bits; } conv = { value };
+  const int exponent = (int)((conv.bits >> 23U) & 0xFFU);
+  *mantissa = conv.bits & 0x7FFFFFU;
+  *shift = 150 - (exponent ? exponent : 1);
+#else
+  union { double value; uint64_t bits; } conv = { value };
+  const int exponent = (int)((conv.bits >> 52U) & 0x7FFU);
+  *mantissa = conv.bits & 0xFFFFFFFFFFFFFULL;
+  *shift = 1075 - (exponent ? exponent : 1);
+#endif
+  if (exponent) {
+    *mantissa |= 1ULL << (DBL_MANT_DIG - 1);
+  }
+}
+
+
 // internal ftoa for fixed decimal floating point
 static size_t _ftoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags)
 {
   char buf[PRINTF_FTOA_BUFFER_SIZE];
   size_t len  = 0U;
-  double diff = 0.0;
 
   // powers of 10
-  static const double pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+  static const uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
 
   // test for special values
   if (value != value)
@@ -467,61 +555,69 @@ static size_t _ftoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, d
     prec--;
   }
 
-  int whole = (int)value;
-  double tmp = (value - whole) * pow10[prec];
-  unsigned long frac = (unsigned long)tmp;
-  diff = tmp - frac;
+  // split the value exactly into its whole part and the fraction / 2^shift, then scale and round
+  // the fraction with integer math only: no (soft) double arithmetic and correctly rounded digits
+  unsigned long long mantissa;
+  int shift;
+  _ftoa_split(value, &mantissa, &shift);
 
-  if (diff > 0.5) {
-    ++frac;
-    // handle rollover, e.g. case 0.99 with prec 1 is 1.0
-    if (frac >= pow10[prec]) {
-      frac = 0;
-      ++whole;
-    }
+  unsigned long long whole = 0U;
+  unsigned long long fraction = 0U;
+  if (shift <= 0) {
+    whole = mantissa << -shift;  // only reached with a PRINTF_MAX_FLOAT above 2^53
   }
-  else if (diff < 0.5) {
+  else if (shift < 64) {
+    whole = mantissa >> shift;
+    fraction = mantissa & ((1ULL << shift) - 1U);
   }
-  else if ((frac == 0U) || (frac & 1U)) {
-    // if halfway, round up if odd OR if last digit is 0
-    ++frac;
+  else {
+    fraction = mantissa;
   }
 
-  if (prec == 0U) {
-    diff = value - (double)whole;
-    if ((!(diff < 0.5) || (diff > 0.5)) && (whole & 1)) {
-      // exactly 0.5 and ODD, then round up
-      // 1.5 -> 2, but 2.5 -> 2
+  // product = fraction * 10^prec as 96 bit number, high * 2^32 + low (fraction < 2^53, 10^prec < 2^30)
+  const uint32_t scale = pow10[prec];
+  const unsigned long long low_product = (fraction & 0xFFFFFFFFULL) * scale;
+  const unsigned long long high = (fraction >> 32U) * scale + (low_product >> 32U);
+  const unsigned long long low = low_product & 0xFFFFFFFFULL;
+
+  // frac = product / 2^shift, compare the remainder to half of 2^shift
+  uint32_t frac = 0U;
+  bool above_half = false;
+  bool half = false;
+  if ((shift > 0) && (shift <= 32)) {
+    frac = (uint32_t)((high << (32 - shift)) | (low >> shift));
+    const unsigned long long rest = low & ((1ULL << shift) - 1U);
+    above_half = rest > (1ULL << (shift - 1));
+    half = rest == (1ULL << (shift - 1));
+  }
+  else if ((shift > 32) && (shift < 84)) {
+    frac = (uint32_t)(high >> (shift - 32));
+    const unsigned long long rest = high & ((1ULL << (shift - 32)) - 1U);
+    const unsigned long long half_rest = 1ULL << (shift - 33);
+    above_half = (rest > half_rest) || ((rest == half_rest) && low);
+    half = (rest == half_rest) && !low;
+  }
+  // else the product is below 2^83 and the remainder below half
+
+  // round half to even, e.g. 0.125 -> 0.12, 1.5 -> 2, but 2.5 -> 2
+  if (above_half || (half && ((prec ? frac : whole) & 1U))) {
+    // handle rollover, e.g. case 0.99 with prec 1 is 1.0
+    if (++frac >= scale) {
+      frac = 0U;
       ++whole;
     }
   }
-  else {
-    unsigned int count = prec;
-    // now do fractional part, as an unsigned number
-    while (len < PRINTF_FTOA_BUFFER_SIZE) {
-      --count;
-      buf[len++] = (char)(48U + (frac % 10U));
-      if (!(frac /= 10U)) {
-        break;
-      }
-    }
-    // add extra 0s
-    while ((len < PRINTF_FTOA_BUFFER_SIZE) && (count-- > 0U)) {
-      buf[len++] = '0';
-    }
+
+  if (prec != 0U) {
+    // fractional part with leading zeros, then the decimal
+    len = _utoa_rev(buf, len, PRINTF_FTOA_BUFFER_SIZE, frac, prec);
     if (len < PRINTF_FTOA_BUFFER_SIZE) {
-      // add decimal
       buf[len++] = '.';
     }
   }
 
   // do whole part, number is reversed
-  while (len < PRINTF_FTOA_BUFFER_SIZE) {
-    buf[len++] = (char)(48 + (whole % 10));
-    if (!(whole /= 10)) {
-      break;
-    }
-  }
+  len = _utoa_rev_long_long(buf, len, PRINTF_FTOA_BUFFER_SIZE, whole);
 
   // pad leading zeros
   if (!(flags & FLAGS_LEFT) && (flags & FLAGS_ZEROPAD)) {
@@ -1,6 +1,12 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
+#include "Common/PoolAllocator.h"
+
+#ifdef STEROIDO_SCHEDULER_STATIC_CAPACITY
+    #include "Common/static_vector.h"
+#endif
+
 /**
  * @brief A really basic Scheduler for a really basic RTOS
  * 
@@ -22,12 +28,12 @@ class Scheduler {
             }
         }
 
-        void addScheduled(ScheduledCallable &callable) {
-            _add<ScheduledCallable>(callable, scheduledSchedule);
+        bool addScheduled(ScheduledCallable &callable) {
+            return _add<ScheduledCallable>(callable, scheduledSchedule);
         }
 
-        void add(ICallable &callable) {
-            _add<ICallable>(callable, callableSchedule);
+        bool add(ICallable &callable) {
+            return _add<ICallable>(callable, callableSchedule);
         }
         
         void removeScheduled(ScheduledCallable &callable) {
@@ -54,26 +60,45 @@ class Scheduler {
                 C *callable;
         };
 
-        std::vector<SchedulerElement<ICallable>> callableSchedule;
-        std::vector<SchedulerElement<ScheduledCallable>> scheduledSchedule;
+        // The lists can have a fixed capacity without any heap usage. Otherwise the bundled vector routes
+        // itself through the pool, the STL one (STEROIDO_STL_VECTOR, set by Steroido.h per platform)
+        // needs an allocator for that
+        #if defined(STEROIDO_SCHEDULER_STATIC_CAPACITY)
+            template<class E>
+            using ScheduleList = static_vector<E, STEROIDO_SCHEDULER_STATIC_CAPACITY>;
+        #elif defined(STEROIDO_POOL_ALLOCATOR_ENABLED) && defined(STEROIDO_STL_VECTOR)
+            template<class E>
+            using ScheduleList = std::vector<E, steroido_intern::PoolStlAllocator<E>>;
+        #else
+            template<class E>
+            using ScheduleList = std::vector<E>;
+        #endif
+
+        ScheduleList<SchedulerElement<ICallable>> callableSchedule;
+        ScheduleList<SchedulerElement<ScheduledCallable>> scheduledSchedule;
 
         template<class C>
-        void _add(C &callable, std::vector<SchedulerElement<C>> &schedule) {
+        bool _add(C &callable, ScheduleList<SchedulerElement<C>> &schedule) {
             // First check if already added
             for (auto &element : schedule) {
-                if (element.callable == &callable) return; // -> element already added
+                if (element.callable == &callable) return true; // -> element already added
             }
 
+            auto oldSize = schedule.size();
+
             #ifdef VECTOR_EMPLACE_BACK_ENABLED
-                schedule.emplace_back((C)callable);
+                schedule.emplace_back(callable);
             #else
                 SchedulerElement<C> element(callable);
                 schedule.push_back(element);
             #endif
+
+            // A list with a fixed capacity rejects the element if it is full
+            return schedule.size() > oldSize;
         }
 
         template<class C>
-        void _remove(C &callable, std::vector<SchedulerElement<C>> &schedule) {
+        void _remove(C &callable, ScheduleList<SchedulerElement<C>> &schedule) {
             for (auto it = schedule.begin(); it != schedule.end(); ++it) {
                 if (it->callable == &callable) {
                     schedule.erase(it);
@@ -4,6 +4,8 @@
 #include "Common/memCpy.h"
 #include "Common/memSet.h"
 #include "Common/mapC.h"
+#include "Common/FastMap.h"
+#include "Common/ArrayKernels.h"
 
 // Define a standard wait time, e.g. for a loop wait
 #define STEROIDO_STD_WAIT_TIME 0.000001 // s
@@ -21,15 +23,19 @@
     // STL (not included in AVR by arduino)
     #ifdef BIG_ARDUINO
         #include <vector>
+        #define STEROIDO_STL_VECTOR
     #else
         #include "Common/vector.h"
     #endif
+    #include "Common/small_vector.h"
+    #include "Common/static_vector.h"
 
     // printf
-    #ifdef TEENSY
+    #if defined(TEENSY) && !defined(STEROIDO_BUFFERED_PRINTF)
         #define printf Serial.printf
     #else
         #include "AbstractionLayer/Arduino/printfIntegration.h"
+        #include "Common/StaticFormat.h"
     #endif
 
     // PinName special case
@@ -39,7 +45,9 @@
 
     // Abstraction Layer
     #include "Common/Callback.h"
+    #include "Common/Event.h"
     #include "Common/CircularBuffer.h"
+    #include "Common/SPSCCircularBuffer.h"
     #include "AbstractionLayer/Arduino/Timer.h"
     #include "AbstractionLayer/Arduino/PinName.h"
     #include "AbstractionLayer/Arduino/PinMode.h"
@@ -47,9 +55,21 @@
     #include "AbstractionLayer/Arduino/AnalogOut.h"
     #include "AbstractionLayer/Arduino/DigitalIn.h"
     #include "AbstractionLayer/Arduino/DigitalOut.h"
+    #include "AbstractionLayer/Arduino/FastDigitalIn.h"
+    #include "AbstractionLayer/Arduino/FastDigitalOut.h"
+    // The STM32 core has its own PortName
+    #ifndef NUCLEO
+        #include "AbstractionLayer/Arduino/BusIn.h"
+        #include "AbstractionLayer/Arduino/BusOut.h"
+        #include "AbstractionLayer/Arduino/PortIn.h"
+        #include "AbstractionLayer/Arduino/PortOut.h"
+    #endif
     #include "AbstractionLayer/Arduino/PwmOut.h"
     #include "Common/DelayedSwitch.h"
     #include "Common/FloatFollower.h"
+    #include "AbstractionLayer/Arduino/SerialByteSink.h"
+    #include "Communication/DeferredLogger.h"
+    #include "Communication/Telemetry.h"
 
     #ifndef STEROIDO_DISABLE_RTOS
         // OS
@@ -86,10 +106,18 @@
 
     // STL
     #include <vector>
+    #define STEROIDO_STL_VECTOR
+    #include "Common/small_vector.h"
+    #include "Common/static_vector.h"
 
     // Abstraction Layer
     #include "Common/Callback.h"
+    #include "Common/Event.h"
     #include "Common/CircularBuffer.h"
+    #include "Common/SPSCCircularBuffer.h"
+    #include "Communication/DeferredLogger.h"
+    #include "Communication/Telemetry.h"
+    #include "AbstractionLayer/Native/FileByteSink.h"
 
     // Main -> Setup/Loop
     #include "Common/setupLoopWrapper.h"
@@ -100,6 +128,7 @@
 
 #ifdef MBED_H
     #include <vector>
+    #define STEROIDO_STL_VECTOR
     #define VECTOR_EMPLACE_BACK_ENABLED
 
     #include "platform/CircularBuffer.h"
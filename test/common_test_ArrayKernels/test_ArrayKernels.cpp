@@ -0,0 +1,114 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/mapC.h"
+#include "Common/ArrayKernels.h"
+
+
+#define SAMPLE_COUNT 37
+
+
+uint16_t adc[SAMPLE_COUNT];
+float values[SAMPLE_COUNT];
+float result[SAMPLE_COUNT + 1];
+
+void fillSamples() {
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        adc[i] = (i * 997) % 4096;
+        values[i] = i * 0.5f - 5;
+    }
+}
+
+
+void convertAndMapTest() {
+    fillSamples();
+
+    // Every length, so the vector part and the rest are both checked
+    LinearMap<float> adcToVolt(0, 4095, 0, 3.3f);
+    for (uint16_t count = 0; count <= SAMPLE_COUNT; count++) {
+        result[count] = -1;
+        convertArray(result, adc, count);
+        for (uint16_t i = 0; i < count; i++) {
+            TEST_ASSERT_EQUAL_FLOAT_MESSAGE(adc[i], result[i], "T1");
+        }
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(-1, result[count], "T2");
+
+        mapArray(result, adc, count, adcToVolt);
+        for (uint16_t i = 0; i < count; i++) {
+            TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-5f, mapC<float>(adc[i], 0, 4095, 0, 3.3f), result[i], "T3");
+        }
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(-1, result[count], "T4");
+    }
+
+    LinearMap<float> inverted(-10, 10, 1, -1);
+    mapArray(result, values, SAMPLE_COUNT, inverted);
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-5f, mapC<float>(values[i], -10, 10, 1, -1), result[i], "T5");
+    }
+
+    // Fixed point and curves through the generic kernel
+    int32_t millivolts[SAMPLE_COUNT];
+    mapArray(millivolts, adc, SAMPLE_COUNT, FixedLinearMap<int32_t, int32_t>(0, 4095, 0, 3300));
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        TEST_ASSERT_INT_WITHIN_MESSAGE(1, mapC<int32_t>(adc[i], 0, 4095, 0, 3300), millivolts[i], "T6");
+    }
+
+    // Narrower destination, the value is mapped before it is converted
+    const uint16_t tenBit[] = {0, 512, 1023};
+    uint8_t eightBit[3];
+    mapArray(eightBit, tenBit, 3, FixedLinearMap<int32_t>(0, 1023, 0, 255));
+    TEST_ASSERT_EQUAL_MESSAGE(0, eightBit[0], "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(128, eightBit[1], "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(255, eightBit[2], "T10");
+
+    const float in[] = {0, 1000, 4095};
+    const float out[] = {0, 10, 20};
+    mapArray(result, adc, SAMPLE_COUNT, PiecewiseLinearMap<float, 3>(in, out));
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        float expected = adc[i] < 1000 ? adc[i] / 100.0f : mapC<float>(adc[i], 1000, 4095, 10, 20);
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, expected, result[i], "T7");
+    }
+}
+
+void clampScaleOffsetTest() {
+    fillSamples();
+
+    clampArray(result, values, SAMPLE_COUNT, -2.0f, 3.0f);
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        float expected = values[i] < -2 ? -2 : (values[i] > 3 ? 3 : values[i]);
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(expected, result[i], "T1");
+    }
+
+    // In place
+    clampArray(values, SAMPLE_COUNT, -2.0f, 3.0f);
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(result[i], values[i], "T2");
+    }
+
+    int16_t raw[SAMPLE_COUNT];
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) raw[i] = i * 100 - 1000;
+    clampArray<int16_t>(raw, SAMPLE_COUNT, 0, 1000);
+    TEST_ASSERT_EQUAL_MESSAGE(0, raw[0], "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(500, raw[15], "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(1000, raw[SAMPLE_COUNT - 1], "T5");
+
+    fillSamples();
+    scaleArray(result, values, SAMPLE_COUNT, 2.0f);
+    offsetArray(result, SAMPLE_COUNT, 1.0f);
+    scaleArray(values, SAMPLE_COUNT, 2.0f);
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE((i * 0.5f - 5) * 2 + 1, result[i], "T6");
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE((i * 0.5f - 5) * 2, values[i], "T7");
+    }
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(convertAndMapTest);
+    RUN_TEST(clampScaleOffsetTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,93 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Communication/BufferedOutput.h"
+
+
+#define SINK_SIZE 256
+
+
+// Required by the printf library, unused here
+void _putchar(char) {}
+
+/**
+ * @brief Collects the written bytes, accepts at most limit bytes per write
+ *
+ */
+class MemorySink : public IByteSink {
+    public:
+        size_t write(const uint8_t *data, size_t length) override {
+            if (length > limit) length = limit;
+            if (length > SINK_SIZE - size) length = SINK_SIZE - size;
+            memcpy(bytes + size, data, length);
+            size += length;
+            bytes[size] = 0;
+            return length;
+        }
+
+        uint8_t bytes[SINK_SIZE + 1] = {0};
+        size_t size = 0;
+        size_t limit = SINK_SIZE;
+};
+
+
+void printTest() {
+    MemorySink sink;
+    BufferedOutput<32> output(sink);
+
+    TEST_ASSERT_EQUAL_MESSAGE(10, output.print("a=%d b=%.1f", -5, 2.5), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, sink.size, "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(10, output.pending(), "T3");
+
+    output.call();
+    TEST_ASSERT_EQUAL_MESSAGE(0, output.pending(), "T4");
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("a=-5 b=2.5", (const char*)sink.bytes, "T5");
+
+    // Wraps around the end of the buffer, the text stays in one piece
+    TEST_ASSERT_TRUE_MESSAGE(output.write("01234567890123456789", 20), "T6");
+    output.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(10, output.print("%s|%04x|", "wrap", 0xbeef), "T7");
+    TEST_ASSERT_TRUE_MESSAGE(output.write('!'), "T8");
+    output.drain();
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("a=-5 b=2.501234567890123456789wrap|beef|!", (const char*)sink.bytes, "T9");
+
+    // Format parsed at compile time
+    TEST_ASSERT_EQUAL_MESSAGE(6, output.print(STEROIDO_FORMAT("%s=%3u"), "id", 7u), "T10");
+    output.drain();
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("a=-5 b=2.501234567890123456789wrap|beef|!id=  7", (const char*)sink.bytes, "T11");
+}
+
+void overflowTest() {
+    MemorySink sink;
+    BufferedOutput<16> output(sink);
+
+    // Exactly fitting messages are complete, bigger ones are dropped as a whole
+    TEST_ASSERT_EQUAL_MESSAGE(10, output.print("%d", 1234567890), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(-1, output.print("%d", 1234567), "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(6, output.print("%06d", 42), "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(16, output.pending(), "T4");
+    TEST_ASSERT_FALSE_MESSAGE(output.write('x'), "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(2, output.overflowCount(), "T6");
+
+    // The sink only takes a few bytes per call, the rest stays buffered
+    sink.limit = 5;
+    TEST_ASSERT_EQUAL_MESSAGE(5, output.drain(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(11, output.pending(), "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(3, output.drain(3), "T9");
+    output.call();
+    output.call();
+    output.call();
+    TEST_ASSERT_EQUAL_MESSAGE(0, output.pending(), "T10");
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("1234567890000042", (const char*)sink.bytes, "T11");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(printTest);
+    RUN_TEST(overflowTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,129 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+// Runs on the simulated ports only
+#ifdef USE_NATIVE
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+    #include "AbstractionLayer/Arduino/PinMode.h"
+    #include "AbstractionLayer/Arduino/DigitalOut.h"
+    #include "AbstractionLayer/Arduino/BusOut.h"
+    #include "AbstractionLayer/Arduino/BusIn.h"
+    #include "AbstractionLayer/Arduino/PortOut.h"
+    #include "AbstractionLayer/Arduino/PortIn.h"
+
+
+void busOutTest() {
+    simulatedGpio().reset();
+
+    // D0 to D7 are PORTD 0 to 7, they start LOW (even if the pull-ups were on)
+    simulatedGpio().ports[SimulatedGpio::PortD].output = 0xFF;
+    BusOut data(0, 1, 2, 3, 4, 5, 6, 7);
+    TEST_ASSERT_EQUAL_MESSAGE(0xFF, simulatedGpio().ports[SimulatedGpio::PortD].direction, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0xFF, data.mask(), "T2");
+    TEST_ASSERT_TRUE_MESSAGE(data.is_pin_connected(7), "T3");
+    TEST_ASSERT_FALSE_MESSAGE(data.is_pin_connected(8), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().ports[SimulatedGpio::PortD].output, "T5");
+
+    // A single masked write for the whole bus
+    simulatedGpio().accesses = 0;
+    data = 0xA5;
+    TEST_ASSERT_EQUAL_MESSAGE(0xA5, simulatedGpio().ports[SimulatedGpio::PortD].output, "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(4, simulatedGpio().accesses, "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(0xA5, (int)data, "T8");
+
+    // Instead of 8 digitalWrite()
+    DigitalOut pin(8);
+    simulatedGpio().accesses = 0;
+    for (uint8_t i = 0; i < 8; i++) pin = i & 1;
+    TEST_ASSERT_EQUAL_MESSAGE(8 * 8, simulatedGpio().accesses, "T9");
+
+    // Other pins of the port stay untouched
+    BusOut low(0, 1, 2, 3);
+    low = 0x0;
+    TEST_ASSERT_EQUAL_MESSAGE(0xA0, simulatedGpio().ports[SimulatedGpio::PortD].output, "T10");
+
+    // Across ports: D6, D7 (PORTD 6, 7), D8, D9 (PORTB 0, 1), A0 (PORTC 0)
+    BusOut split(6, 7, 8, 9, 14);
+    simulatedGpio().accesses = 0;
+    split = 0x1B;
+    TEST_ASSERT_EQUAL_MESSAGE(3 * 4, simulatedGpio().accesses, "T11");
+    TEST_ASSERT_EQUAL_MESSAGE(0xE0, simulatedGpio().ports[SimulatedGpio::PortD].output, "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(0x02, simulatedGpio().ports[SimulatedGpio::PortB].output, "T13");
+    TEST_ASSERT_EQUAL_MESSAGE(0x01, simulatedGpio().ports[SimulatedGpio::PortC].output, "T14");
+    TEST_ASSERT_EQUAL_MESSAGE(0x1B, split.read(), "T15");
+
+    // Pins in any order
+    const PinName reversed[] = {11, 10, 9, 8, 19};
+    BusOut scrambled(reversed, 5);
+    scrambled = 0x13;
+    TEST_ASSERT_EQUAL_MESSAGE(0x0C, simulatedGpio().ports[SimulatedGpio::PortB].output, "T16");
+    TEST_ASSERT_EQUAL_MESSAGE(0x21, simulatedGpio().ports[SimulatedGpio::PortC].output, "T17");
+    TEST_ASSERT_EQUAL_MESSAGE(0x13, scrambled.read(), "T18");
+    for (int value = 0; value < 32; value++) {
+        scrambled = value;
+        TEST_ASSERT_EQUAL_MESSAGE(value, scrambled.read(), "T19");
+    }
+}
+
+void busInTest() {
+    simulatedGpio().reset();
+
+    BusIn buttons(15, 16, 2, 3);
+    TEST_ASSERT_EQUAL_MESSAGE(0, buttons.read(), "T1");
+
+    buttons.mode(PullUp);
+    TEST_ASSERT_EQUAL_MESSAGE(0xF, buttons.read(), "T2");
+    simulatedGpio().drive(16, 0);
+    simulatedGpio().drive(3, 0);
+    simulatedGpio().accesses = 0;
+    TEST_ASSERT_EQUAL_MESSAGE(0x5, (int)buttons, "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(2, simulatedGpio().accesses, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0xF, buttons.mask(), "T5");
+
+    buttons.mode(OpenDrain);
+    simulatedGpio().drive(15, 1);
+    TEST_ASSERT_EQUAL_MESSAGE(0x1, buttons.read(), "T6");
+}
+
+void portTest() {
+    simulatedGpio().reset();
+
+    PortOut leds(PortB, 0x0F);
+    PortIn switches(PortC, 0x30);
+    TEST_ASSERT_EQUAL_MESSAGE(0x0F, simulatedGpio().ports[SimulatedGpio::PortB].direction, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0x00, simulatedGpio().ports[SimulatedGpio::PortC].direction, "T2");
+
+    simulatedGpio().accesses = 0;
+    leds = 0xFA;
+    TEST_ASSERT_EQUAL_MESSAGE(0x0A, simulatedGpio().ports[SimulatedGpio::PortB].output, "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(4, simulatedGpio().accesses, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0x0A, (int)leds, "T5");
+
+    simulatedGpio().drive(18, 1);
+    simulatedGpio().drive(14, 1);
+    TEST_ASSERT_EQUAL_MESSAGE(0x10, switches.read(), "T6");
+    switches.mode(PullUp);
+    TEST_ASSERT_EQUAL_MESSAGE(0x30, (int)switches, "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(0x30, simulatedGpio().ports[SimulatedGpio::PortC].output, "T8");
+
+    // A port which does not exist is not connected to anything
+    PortOut missing(PortE);
+    missing = 0xFF;
+    TEST_ASSERT_EQUAL_MESSAGE(0x0A, simulatedGpio().ports[SimulatedGpio::PortB].output, "T9");
+}
+
+#endif // USE_NATIVE
+
+
+void setup() {
+    UNITY_BEGIN();
+#ifdef USE_NATIVE
+    RUN_TEST(busOutTest);
+    RUN_TEST(busInTest);
+    RUN_TEST(portTest);
+#endif
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,98 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#define STEROIDO_CACHED_OUTPUTS
+
+#include "Common/TestingHeader.h"
+
+// Runs on the simulated ports only
+#ifdef USE_NATIVE
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+    #include "AbstractionLayer/Arduino/DigitalOut.h"
+    #include "AbstractionLayer/Arduino/PwmOut.h"
+    #include "AbstractionLayer/Arduino/AnalogOut.h"
+
+
+void digitalOutTest() {
+    simulatedGpio().reset();
+
+    // D8 pulled up before, the first write goes through even if it seems to be the same
+    simulatedGpio().ports[SimulatedGpio::PortB].output = 0x01;
+    DigitalOut pin(8);
+    simulatedGpio().accesses = 0;
+    pin = 1;
+    TEST_ASSERT_EQUAL_MESSAGE(8, simulatedGpio().accesses, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(8), "T2");
+
+    // Repeated writes cost nothing
+    simulatedGpio().accesses = 0;
+    pin = 1;
+    pin = 5;
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().accesses, "T3");
+
+    pin = 0;
+    TEST_ASSERT_EQUAL_MESSAGE(8, simulatedGpio().accesses, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().level(8), "T5");
+    pin.toggle();
+    TEST_ASSERT_EQUAL_MESSAGE(16, simulatedGpio().accesses, "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(8), "T7");
+
+    // A new output writes its initial value, also LOW
+    DigitalOut low(9, 0);
+    TEST_ASSERT_EQUAL_MESSAGE(0, low.read(), "T8");
+    simulatedGpio().accesses = 0;
+    low = 0;
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().accesses, "T9");
+}
+
+void pwmOutTest() {
+    simulatedGpio().reset();
+
+    // The first write goes through, even 0
+    PwmOut pwm(9);
+    simulatedGpio().analogValues[9] = 77;
+    simulatedGpio().accesses = 0;
+    pwm.write_u16(0);
+    TEST_ASSERT_TRUE_MESSAGE(simulatedGpio().accesses > 0, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().analogValues[9], "T2");
+
+    // Only the upper 8 bit reach analogWrite, the lower ones are still remembered
+    simulatedGpio().accesses = 0;
+    pwm.write_u16(0x00FF);
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().accesses, "T3");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0x00FF / 65535.0f, pwm.read(), "T4");
+
+    pwm.write_u16(0x1234);
+    TEST_ASSERT_TRUE_MESSAGE(simulatedGpio().accesses > 0, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(0x12, simulatedGpio().analogValues[9], "T6");
+    simulatedGpio().accesses = 0;
+    pwm.write_u16(0x12FF);
+    pwm.write_u16(0x1200);
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().accesses, "T7");
+
+    pwm = 1.0f;
+    TEST_ASSERT_EQUAL_MESSAGE(255, simulatedGpio().analogValues[9], "T8");
+
+    // AnalogOut the same way
+    AnalogOut analog(10);
+    analog.write_u16(0x8000);
+    TEST_ASSERT_EQUAL_MESSAGE(0x80, simulatedGpio().analogValues[10], "T9");
+    simulatedGpio().accesses = 0;
+    analog.write_u16(0x80FF);
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().accesses, "T10");
+    analog.write_u16(0x8100);
+    TEST_ASSERT_EQUAL_MESSAGE(0x81, simulatedGpio().analogValues[10], "T11");
+}
+
+#endif // USE_NATIVE
+
+
+void setup() {
+    UNITY_BEGIN();
+#ifdef USE_NATIVE
+    RUN_TEST(digitalOutTest);
+    RUN_TEST(pwmOutTest);
+#endif
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,398 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/CircularBuffer.h"
+#include "Common/AdvancedCircularBuffer.h"
+
+
+// One power of two size (masking specialization) and one generic size (compare wrapping)
+#define POW2_BUFFER_SIZE 8
+#define GENERIC_BUFFER_SIZE 10
+#define OPERATION_COUNT 2000
+
+
+/**
+ * @brief Simple reference model of a ring buffer overwriting the oldest element if full
+ *
+ * @tparam BufferSize
+ */
+template<uint16_t BufferSize>
+class ReferenceBuffer {
+    public:
+        ReferenceBuffer() : count(0) {}
+
+        void push(uint16_t value) {
+            if (count == BufferSize) dropOldest();
+            elements[count++] = value;
+        }
+
+        void dropOldest() {
+            for (uint16_t i = 1; i < count; i++) elements[i - 1] = elements[i];
+            count--;
+        }
+
+        uint16_t elements[BufferSize];
+        uint16_t count;
+};
+
+/**
+ * @brief Deterministic pseudo random numbers, so a failing run can be reproduced
+ *
+ */
+uint16_t nextRandom() {
+    static uint32_t state = 12345;
+    state = state * 1103515245UL + 12345UL;
+    return (state >> 16) & 0x7FFF;
+}
+
+
+template<uint16_t BufferSize>
+void circularBufferTest() {
+    CircularBuffer<uint16_t, BufferSize> buffer;
+    ReferenceBuffer<BufferSize> reference;
+    uint16_t value = 0;
+    uint16_t nextValue = 0;
+
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T1");
+    TEST_ASSERT_FALSE_MESSAGE(buffer.pop(value), "T2");
+
+    for (uint16_t i = 0; i < OPERATION_COUNT; i++) {
+        if (nextRandom() % 3) {
+            buffer.push(nextValue);
+            reference.push(nextValue++);
+        } else {
+            bool popped = buffer.pop(value);
+            TEST_ASSERT_EQUAL_MESSAGE(reference.count > 0, popped, "T3");
+            if (popped) {
+                TEST_ASSERT_EQUAL_MESSAGE(reference.elements[0], value, "T4");
+                reference.dropOldest();
+            }
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE(reference.count, buffer.size(), "T5");
+        TEST_ASSERT_EQUAL_MESSAGE(reference.count == BufferSize, buffer.full(), "T6");
+        TEST_ASSERT_EQUAL_MESSAGE(reference.count == 0, buffer.empty(), "T7");
+    }
+
+    buffer.reset();
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(0, buffer.size(), "T9");
+}
+
+template<uint16_t BufferSize>
+void advancedCircularBufferTest() {
+    AdvancedCircularBuffer<uint16_t, BufferSize> buffer;
+    ReferenceBuffer<BufferSize> reference;
+    uint16_t value = 0;
+    uint16_t nextValue = 0;
+
+    for (uint16_t i = 0; i < OPERATION_COUNT; i++) {
+        uint16_t operation = nextRandom() % 11;
+
+        if (operation < 4) {
+            buffer.push(nextValue);
+            reference.push(nextValue++);
+        } else if (operation == 4) {
+            TEST_ASSERT_EQUAL_MESSAGE(reference.count > 0, buffer.pop(value), "T1");
+            if (reference.count) reference.dropOldest();
+        } else if (operation == 5 && reference.count) {
+            // Delete a random element
+            uint16_t index = nextRandom() % reference.count;
+            TEST_ASSERT_TRUE_MESSAGE(buffer.deleteFromTail(index), "T2");
+            for (uint16_t j = index + 1; j < reference.count; j++) reference.elements[j - 1] = reference.elements[j];
+            reference.count--;
+        } else if (operation == 6 && reference.count) {
+            // Delete the newest element by its value
+            TEST_ASSERT_TRUE_MESSAGE(buffer.deleteElement(reference.elements[reference.count - 1]), "T3");
+            reference.count--;
+        } else if (operation == 7 && reference.count < BufferSize) {
+            // Push to the beginning
+            buffer.pushBack(nextValue);
+            for (uint16_t j = reference.count; j > 0; j--) reference.elements[j] = reference.elements[j - 1];
+            reference.elements[0] = nextValue++;
+            reference.count++;
+        } else if (operation == 8 && reference.count) {
+            // Delete a random range
+            uint16_t index = nextRandom() % reference.count;
+            uint16_t amount = nextRandom() % (reference.count - index + 1);
+            TEST_ASSERT_TRUE_MESSAGE(buffer.deleteRangeFromTail(index, amount), "T12");
+            TEST_ASSERT_FALSE_MESSAGE(buffer.deleteRangeFromTail(index, reference.count + 1), "T13");
+            for (uint16_t j = index + amount; j < reference.count; j++) reference.elements[j - amount] = reference.elements[j];
+            reference.count -= amount;
+        } else if (operation == 9 && reference.count) {
+            // Delete a random element, the newest one takes its place
+            uint16_t index = nextRandom() % reference.count;
+            TEST_ASSERT_TRUE_MESSAGE(buffer.deleteFromTailUnordered(index), "T14");
+            reference.elements[index] = reference.elements[--reference.count];
+        } else if (operation == 10) {
+            // Delete all elements divisible by a random divisor
+            uint16_t divisor = nextRandom() % 4 + 2;
+            uint16_t kept = 0;
+            for (uint16_t j = 0; j < reference.count; j++) {
+                if (reference.elements[j] % divisor) reference.elements[kept++] = reference.elements[j];
+            }
+            uint16_t deleted = buffer.deleteIf([divisor](const uint16_t &element) { return element % divisor == 0; });
+            TEST_ASSERT_EQUAL_MESSAGE(reference.count - kept, deleted, "T15");
+            reference.count = kept;
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE(reference.count, buffer.size(), "T4");
+        TEST_ASSERT_EQUAL_MESSAGE(BufferSize - reference.count, buffer.leftCapacity(), "T5");
+
+        for (uint16_t j = 0; j < reference.count; j++) {
+            TEST_ASSERT_EQUAL_MESSAGE(reference.elements[j], buffer.getReferenceFromTail(j), "T6");
+            TEST_ASSERT_EQUAL_MESSAGE(reference.elements[reference.count - 1 - j], buffer.getReferenceFromHead(j), "T7");
+        }
+
+        // Iterators must visit the same elements
+        uint16_t j = 0;
+        for (uint16_t &element : buffer) {
+            TEST_ASSERT_EQUAL_MESSAGE(reference.elements[j++], element, "T8");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(reference.count, j, "T9");
+
+        const AdvancedCircularBuffer<uint16_t, BufferSize> &constBuffer = buffer;
+        for (auto it = constBuffer.rbegin(); it != constBuffer.rend(); ++it) {
+            TEST_ASSERT_EQUAL_MESSAGE(reference.elements[--j], *it, "T10");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(0, j, "T11");
+    }
+
+    // Bulk deletes
+    buffer.reset();
+    while (!buffer.full()) buffer.push(nextValue++);
+    TEST_ASSERT_TRUE_MESSAGE(buffer.deleteAmountFromTail(2), "T16");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.deleteAmountFromHead(3), "T17");
+    TEST_ASSERT_FALSE_MESSAGE(buffer.deleteAmountFromHead(BufferSize), "T18");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 5, buffer.size(), "T19");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.getTail(value), "T20");
+    TEST_ASSERT_EQUAL_MESSAGE(nextValue - BufferSize + 2, value, "T21");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.getHead(value), "T22");
+    TEST_ASSERT_EQUAL_MESSAGE(nextValue - 4, value, "T23");
+}
+
+/**
+ * @brief Bulk push/pop and the segment access work the same for both buffers
+ *
+ * @tparam Buffer CircularBuffer or AdvancedCircularBuffer with uint16_t elements
+ * @tparam BufferSize
+ */
+template<class Buffer, uint16_t BufferSize>
+void bulkTest() {
+    Buffer buffer;
+    typename Buffer::Segment first, second;
+    uint16_t input[3 * BufferSize];
+    uint16_t output[3 * BufferSize];
+
+    for (uint16_t i = 0; i < 3 * BufferSize; i++) input[i] = i;
+
+    // Wrap the segments around the end of the pool
+    buffer.push(input, BufferSize - 2);
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 3, buffer.pop(output, BufferSize - 3), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 4, output[BufferSize - 4], "T2");
+
+    TEST_ASSERT_EQUAL_MESSAGE(5, buffer.push(input + BufferSize, 5), "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(6, buffer.readSegments(first, second), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(3, first.length, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(3, second.length, "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 3, first.data[0], "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize + 2, second.data[0], "T8");
+
+    // Process in place
+    buffer.release(first.length);
+    TEST_ASSERT_EQUAL_MESSAGE(3, buffer.size(), "T9");
+
+    // Write in place
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 3, buffer.writeSegments(first, second), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize - 3, first.length + second.length, "T11");
+    first.data[0] = 1000;
+    first.data[1] = 1001;
+    buffer.commit(2);
+
+    TEST_ASSERT_EQUAL_MESSAGE(5, buffer.pop(output, 3 * BufferSize), "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize + 2, output[0], "T13");
+    TEST_ASSERT_EQUAL_MESSAGE(1001, output[4], "T14");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T15");
+
+    // Overfill keeps the newest elements only
+    buffer.push(input, 2);
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, buffer.push(input, 3 * BufferSize), "T16");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.full(), "T17");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, buffer.pop(output, 3 * BufferSize), "T18");
+    for (uint16_t i = 0; i < BufferSize; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(2 * BufferSize + i, output[i], "T19");
+    }
+
+    // Partial overwrite drops the oldest elements
+    buffer.push(input, BufferSize - 1);
+    buffer.push(input + 2 * BufferSize, 3);
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, buffer.pop(output, 3 * BufferSize), "T20");
+    TEST_ASSERT_EQUAL_MESSAGE(2, output[0], "T21");
+    TEST_ASSERT_EQUAL_MESSAGE(2 * BufferSize + 2, output[BufferSize - 1], "T22");
+}
+
+struct Frame {
+    uint32_t id;
+    uint8_t data[8];
+};
+
+/**
+ * @brief Elements are written and read in place with reserve/commit and peek/release
+ *
+ * @tparam Buffer CircularBuffer or AdvancedCircularBuffer with Frame elements
+ * @tparam BufferSize
+ */
+template<class Buffer, uint16_t BufferSize>
+void zeroCopyTest() {
+    Buffer buffer;
+
+    TEST_ASSERT_NULL_MESSAGE(buffer.peek(), "T1");
+
+    for (uint16_t i = 0; i < BufferSize + 2; i++) {
+        Frame *frame = buffer.reserve();
+        frame->id = i;
+        frame->data[7] = i;
+        buffer.commit();
+    }
+
+    // Oldest two frames got dropped while reserving
+    TEST_ASSERT_TRUE_MESSAGE(buffer.full(), "T2");
+    for (uint16_t i = 2; i < BufferSize + 2; i++) {
+        const Frame *frame = buffer.peek();
+        TEST_ASSERT_NOT_NULL_MESSAGE(frame, "T3");
+        TEST_ASSERT_EQUAL_MESSAGE(i, frame->id, "T4");
+        TEST_ASSERT_EQUAL_MESSAGE(i, frame->data[7], "T5");
+        buffer.release();
+    }
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T6");
+
+    // Not committed -> not in the buffer
+    buffer.reserve()->id = 1;
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T7");
+}
+
+/**
+ * @brief Overflows are handled by the policy, counted and the high-water mark is tracked
+ *
+ * @tparam Overwrite Buffer with the OverwriteOldest policy
+ * @tparam Reject Buffer with the RejectNewest policy
+ * @tparam BufferSize
+ */
+template<class Overwrite, class Reject, uint16_t BufferSize>
+void overflowPolicyTest() {
+    Overwrite overwrite;
+    Reject reject;
+    uint16_t input[BufferSize + 3];
+    uint16_t value = 0;
+
+    for (uint16_t i = 0; i < BufferSize + 3; i++) input[i] = i;
+
+    for (uint16_t i = 0; i < BufferSize; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(overwrite.push(i), "T1");
+        TEST_ASSERT_TRUE_MESSAGE(reject.push(i), "T2");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, overwrite.dropCount(), "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, overwrite.peakSize(), "T4");
+
+    // Full: one drops the oldest, the other one the new element
+    TEST_ASSERT_TRUE_MESSAGE(overwrite.push(BufferSize), "T5");
+    TEST_ASSERT_FALSE_MESSAGE(reject.push(BufferSize), "T6");
+    TEST_ASSERT_NULL_MESSAGE(reject.reserve(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(1, overwrite.dropCount(), "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(2, reject.dropCount(), "T9");
+    TEST_ASSERT_TRUE_MESSAGE(overwrite.peek(value), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(1, value, "T11");
+    TEST_ASSERT_TRUE_MESSAGE(reject.peek(value), "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(0, value, "T13");
+
+    // Bulk push into 2 free places
+    overwrite.release(2);
+    reject.release(2);
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, overwrite.push(input, BufferSize + 3), "T14");
+    TEST_ASSERT_EQUAL_MESSAGE(2, reject.push(input, BufferSize + 3), "T15");
+    TEST_ASSERT_EQUAL_MESSAGE(1 + BufferSize + 1, overwrite.dropCount(), "T16");
+    TEST_ASSERT_EQUAL_MESSAGE(2 + BufferSize + 1, reject.dropCount(), "T17");
+    TEST_ASSERT_TRUE_MESSAGE(overwrite.peek(value), "T18");
+    TEST_ASSERT_EQUAL_MESSAGE(3, value, "T19");
+    TEST_ASSERT_TRUE_MESSAGE(reject.peek(value), "T20");
+    TEST_ASSERT_EQUAL_MESSAGE(2, value, "T21");
+
+    // reset() keeps the statistics, the peak only follows the fill level after resetStatistics()
+    overwrite.reset();
+    TEST_ASSERT_EQUAL_MESSAGE(BufferSize, overwrite.peakSize(), "T22");
+    overwrite.resetStatistics();
+    TEST_ASSERT_EQUAL_MESSAGE(0, overwrite.dropCount(), "T23");
+    overwrite.push(input, 3);
+    overwrite.release(2);
+    overwrite.push(input, 1);
+    TEST_ASSERT_EQUAL_MESSAGE(3, overwrite.peakSize(), "T24");
+}
+
+void circularBufferPow2Test() {
+    circularBufferTest<POW2_BUFFER_SIZE>();
+}
+
+void circularBufferGenericTest() {
+    circularBufferTest<GENERIC_BUFFER_SIZE>();
+}
+
+void advancedCircularBufferPow2Test() {
+    advancedCircularBufferTest<POW2_BUFFER_SIZE>();
+}
+
+void advancedCircularBufferGenericTest() {
+    advancedCircularBufferTest<GENERIC_BUFFER_SIZE>();
+}
+
+void bulkPow2Test() {
+    bulkTest<CircularBuffer<uint16_t, POW2_BUFFER_SIZE>, POW2_BUFFER_SIZE>();
+    bulkTest<AdvancedCircularBuffer<uint16_t, POW2_BUFFER_SIZE>, POW2_BUFFER_SIZE>();
+}
+
+void zeroCopyPow2Test() {
+    zeroCopyTest<CircularBuffer<Frame, POW2_BUFFER_SIZE>, POW2_BUFFER_SIZE>();
+    zeroCopyTest<AdvancedCircularBuffer<Frame, POW2_BUFFER_SIZE>, POW2_BUFFER_SIZE>();
+}
+
+void bulkGenericTest() {
+    bulkTest<CircularBuffer<uint16_t, GENERIC_BUFFER_SIZE>, GENERIC_BUFFER_SIZE>();
+    bulkTest<AdvancedCircularBuffer<uint16_t, GENERIC_BUFFER_SIZE>, GENERIC_BUFFER_SIZE>();
+}
+
+void overflowPolicyPow2Test() {
+    overflowPolicyTest<CircularBuffer<uint16_t, POW2_BUFFER_SIZE>,
+                       CircularBuffer<uint16_t, POW2_BUFFER_SIZE, uint16_t, RejectNewest>, POW2_BUFFER_SIZE>();
+    overflowPolicyTest<AdvancedCircularBuffer<uint16_t, POW2_BUFFER_SIZE>,
+                       AdvancedCircularBuffer<uint16_t, POW2_BUFFER_SIZE, size_t, RejectNewest>, POW2_BUFFER_SIZE>();
+}
+
+void overflowPolicyGenericTest() {
+    overflowPolicyTest<CircularBuffer<uint16_t, GENERIC_BUFFER_SIZE>,
+                       CircularBuffer<uint16_t, GENERIC_BUFFER_SIZE, uint16_t, RejectNewest>, GENERIC_BUFFER_SIZE>();
+    overflowPolicyTest<AdvancedCircularBuffer<uint16_t, GENERIC_BUFFER_SIZE>,
+                       AdvancedCircularBuffer<uint16_t, GENERIC_BUFFER_SIZE, size_t, RejectNewest>, GENERIC_BUFFER_SIZE>();
+}
+
+void zeroCopyGenericTest() {
+    zeroCopyTest<CircularBuffer<Frame, GENERIC_BUFFER_SIZE>, GENERIC_BUFFER_SIZE>();
+    zeroCopyTest<AdvancedCircularBuffer<Frame, GENERIC_BUFFER_SIZE>, GENERIC_BUFFER_SIZE>();
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(circularBufferPow2Test);
+    RUN_TEST(circularBufferGenericTest);
+    RUN_TEST(advancedCircularBufferPow2Test);
+    RUN_TEST(advancedCircularBufferGenericTest);
+    RUN_TEST(bulkPow2Test);
+    RUN_TEST(bulkGenericTest);
+    RUN_TEST(zeroCopyPow2Test);
+    RUN_TEST(zeroCopyGenericTest);
+    RUN_TEST(overflowPolicyPow2Test);
+    RUN_TEST(overflowPolicyGenericTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
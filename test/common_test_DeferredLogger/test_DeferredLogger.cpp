@@ -0,0 +1,181 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Communication/DeferredLogger.h"
+
+
+#define SINK_SIZE 512
+
+
+/**
+ * @brief Collects the written bytes, accepts at most limit bytes per write
+ *
+ */
+class MemorySink : public IByteSink {
+    public:
+        size_t write(const uint8_t *data, size_t length) override {
+            if (length > limit) length = limit;
+            if (length > SINK_SIZE - size) length = SINK_SIZE - size;
+            memcpy(bytes + size, data, length);
+            size += length;
+            return length;
+        }
+
+        uint8_t bytes[SINK_SIZE];
+        size_t size = 0;
+        size_t limit = SINK_SIZE;
+};
+
+uint32_t readU32(const uint8_t *data) {
+    uint32_t value;
+    memcpy(&value, data, 4);
+    return value;
+}
+
+/**
+ * @brief Decodes the next record of the sink, checks its framing and CRC
+ *
+ * @return size_t Length of the record without the CRC, 0 if there is no valid one
+ */
+size_t nextRecord(const MemorySink &sink, size_t &position, uint8_t *record) {
+    const uint8_t *end = (const uint8_t*)memchr(sink.bytes + position, 0, sink.size - position);
+    if (!end) return 0;
+
+    size_t encodedLength = end - (sink.bytes + position);
+    size_t length = cobsDecode(sink.bytes + position, encodedLength, record, 256);
+    position += encodedLength + 1;
+    if (length < 3) return 0;
+
+    length -= 2;
+    uint16_t crc = record[length] | (record[length + 1] << 8);
+    return crc == crc16(record, length) ? length : 0;
+}
+
+const char *helloFormat = "Hello %s, %d %u %c %f\n";
+
+
+void recordTest() {
+    MemorySink sink;
+    DeferredLogger<128> logger(sink);
+    uint8_t record[256];
+    size_t position = 0;
+
+    // First use sends the format string, then the message
+    TEST_ASSERT_TRUE_MESSAGE(logger.log(helloFormat, "you", (int16_t)-2, (uint32_t)7, 'x', 1.5f), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, sink.size, "T2");
+    logger.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(0, logger.pending(), "T3");
+
+    uint16_t formatLength = strlen(helloFormat);
+    TEST_ASSERT_EQUAL_MESSAGE(1 + 4 + formatLength, nextRecord(sink, position, record), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogFormat, record[0], "T5");
+    uint32_t id = readU32(record + 1);
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(record + 5, helloFormat, formatLength) == 0, "T6");
+
+    const uint8_t expectedArguments[] = {'s', 3, 'y', 'o', 'u', 'h', 0xFE, 0xFF, 'I', 7, 0, 0, 0, 'c', 'x', 'f'};
+    TEST_ASSERT_EQUAL_MESSAGE(1 + 4 + sizeof(expectedArguments) + 4, nextRecord(sink, position, record), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogMessage, record[0], "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(id, readU32(record + 1), "T9");
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(record + 5, expectedArguments, sizeof(expectedArguments)) == 0, "T10");
+    float value;
+    memcpy(&value, record + 5 + sizeof(expectedArguments), 4);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(1.5f, value, "T11");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T12");
+
+    // Afterwards only the message is sent
+    logger.log(helloFormat, "", (int16_t)0, (uint32_t)0, 'y', 0.0f);
+    logger.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(22, nextRecord(sink, position, record), "T13");
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogMessage, record[0], "T13");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T14");
+
+    // Until the formats are reset
+    logger.resendFormats();
+    logger.log(helloFormat, "", (int16_t)0, (uint32_t)0, 'y', 0.0f);
+    logger.drain();
+    nextRecord(sink, position, record);
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogFormat, record[0], "T15");
+}
+
+void dropAndDrainTest() {
+    MemorySink sink;
+    DeferredLogger<40, 2> logger(sink);
+    uint8_t record[256];
+    size_t position = 0;
+
+    // Format record 1 + 4 + 5 + 2 and message record 1 + 4 + 5 + 2 bytes, +1 code byte and +1 zero each
+    TEST_ASSERT_TRUE_MESSAGE(logger.log("n=%d\n", (int32_t)1), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(28, logger.pending(), "T2");
+    TEST_ASSERT_FALSE_MESSAGE(logger.log("n=%d\n", (int32_t)2), "T3");
+    TEST_ASSERT_FALSE_MESSAGE(logger.log("n=%d\n", (int32_t)3), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(2, logger.dropCount(), "T5");
+
+    // The sink only takes a few bytes at once, the rest stays buffered
+    sink.limit = 5;
+    TEST_ASSERT_EQUAL_MESSAGE(5, logger.drain(), "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(23, logger.pending(), "T7");
+    sink.limit = SINK_SIZE;
+    logger.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(28, sink.size, "T8");
+    nextRecord(sink, position, record);
+    nextRecord(sink, position, record);
+
+    // The next message reports the drops first
+    TEST_ASSERT_TRUE_MESSAGE(logger.log("n=%d\n", (int32_t)4), "T9");
+    logger.call();
+    TEST_ASSERT_EQUAL_MESSAGE(5, nextRecord(sink, position, record), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogDropped, record[0], "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(2, readU32(record + 1), "T11");
+    TEST_ASSERT_EQUAL_MESSAGE(10, nextRecord(sink, position, record), "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(DeferredLogMessage, record[0], "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(4, readU32(record + 6), "T13");
+
+    // Records wrap around the end of the buffer, zeros in the values are encoded
+    for (int32_t i = 0; i < 20; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(logger.log("n=%d\n", i), "T14");
+        logger.drain();
+        TEST_ASSERT_EQUAL_MESSAGE(10, nextRecord(sink, position, record), "T15");
+        TEST_ASSERT_EQUAL_MESSAGE(i, (int32_t)readU32(record + 6), "T15");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T16");
+}
+
+void resyncTest() {
+    MemorySink sink;
+    DeferredLogger<128> logger(sink);
+    uint8_t record[256];
+    size_t position = 0;
+
+    // A lost byte only spoils its own record
+    logger.log("a=%d\n", (int32_t)1);
+    logger.log("a=%d\n", (int32_t)2);
+    logger.drain();
+    sink.bytes[20] ^= 0x55;
+    TEST_ASSERT_EQUAL_MESSAGE(10, nextRecord(sink, position, record), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, nextRecord(sink, position, record), "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(10, nextRecord(sink, position, record), "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(2, readU32(record + 6), "T4");
+
+    // The formats are sent again periodically, for a host connecting later
+    uint16_t formats = 0;
+    for (uint16_t i = 0; i < 2 * STEROIDO_DEFERRED_LOG_RESEND_INTERVAL; i++) {
+        logger.log("a=%d\n", (int32_t)i);
+        logger.drain();
+        while (nextRecord(sink, position, record)) {
+            if (record[0] == DeferredLogFormat) formats++;
+        }
+        sink.size = position = 0;
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(2, formats, "T5");
+}
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(recordTest);
+    RUN_TEST(dropAndDrainTest);
+    RUN_TEST(resyncTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,55 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#define STEROIDO_DIRECT_PINS
+
+#include "Common/TestingHeader.h"
+
+// Runs on the simulated ports only
+#ifdef USE_NATIVE
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+    #include "AbstractionLayer/Arduino/DigitalOut.h"
+
+
+void directOutputTest() {
+    simulatedGpio().reset();
+
+    // Keeps the level the pin had (e.g. pulled up before)
+    simulatedGpio().ports[SimulatedGpio::PortB].output = 0x01;
+    DigitalOut pin(8);
+    TEST_ASSERT_EQUAL_MESSAGE(0x01, simulatedGpio().ports[SimulatedGpio::PortB].direction, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(8), "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(1, pin.read(), "T3");
+
+    // The register is written directly, without the table lookups of digitalWrite
+    simulatedGpio().accesses = 0;
+    pin = 0;
+    TEST_ASSERT_EQUAL_MESSAGE(4, simulatedGpio().accesses, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().level(8), "T5");
+
+    simulatedGpio().accesses = 0;
+    pin.toggle();
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().accesses, "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(8), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(1, pin.read(), "T8");
+
+    // Other pins of the port stay untouched
+    DigitalOut other(13, 1);
+    TEST_ASSERT_EQUAL_MESSAGE(0x21, simulatedGpio().ports[SimulatedGpio::PortB].output, "T9");
+    other = 0;
+    pin = 0;
+    TEST_ASSERT_EQUAL_MESSAGE(0x00, simulatedGpio().ports[SimulatedGpio::PortB].output, "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(0x00, simulatedGpio().ports[SimulatedGpio::PortD].output, "T11");
+}
+
+#endif // USE_NATIVE
+
+
+void setup() {
+    UNITY_BEGIN();
+#ifdef USE_NATIVE
+    RUN_TEST(directOutputTest);
+#endif
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,182 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/Event.h"
+
+
+uint16_t functionSum = 0;
+uint16_t functionCallCounter = 0;
+
+void addToSum(uint16_t value) {
+    functionSum += value;
+    functionCallCounter++;
+}
+
+class TestClass {
+    public:
+        TestClass() : sum(0), callCounter(0) {}
+
+        void add(uint16_t value) {
+            sum += value;
+            callCounter++;
+        }
+
+        uint16_t sum;
+        uint16_t callCounter;
+};
+
+/**
+ * @brief Listener disconnecting another Listener (or itself) while the Event is emitting
+ *
+ */
+class DisconnectingListener : public EventListener<uint16_t> {
+    public:
+        DisconnectingListener() : toDisconnect(nullptr), callCounter(0) {}
+
+        void onEvent(uint16_t) {
+            callCounter++;
+            if (toDisconnect) toDisconnect->disconnect();
+        }
+
+        EventListener<uint16_t> *toDisconnect;
+        uint16_t callCounter;
+};
+
+/**
+ * @brief Listener connecting another Listener to its Event while the Event is emitting
+ *
+ */
+class ConnectingListener : public EventListener<uint16_t> {
+    public:
+        ConnectingListener(Event<uint16_t> &event) : event(event), toConnect(nullptr), callCounter(0) {}
+
+        void onEvent(uint16_t) {
+            callCounter++;
+            if (toConnect) event.connect(*toConnect);
+        }
+
+        Event<uint16_t> &event;
+        EventListener<uint16_t> *toConnect;
+        uint16_t callCounter;
+};
+
+
+void eventTest() {
+    Event<uint16_t> event;
+    TestClass testClass;
+
+    EventFunctionListener<uint16_t> functionListener(addToSum);
+    EventMethodListener<TestClass, uint16_t> methodListener(testClass, &TestClass::add);
+
+    // Emit without Listeners
+    event.emit(1);
+    TEST_ASSERT_TRUE_MESSAGE(event.empty(), "T1");
+
+    // Connect
+    event.connect(functionListener);
+    event.connect(methodListener);
+    event.connect(methodListener);
+    TEST_ASSERT_EQUAL_MESSAGE(2, event.listenerCount(), "T2");
+    TEST_ASSERT_TRUE_MESSAGE(methodListener.connected(), "T3");
+
+    event.emit(5);
+    TEST_ASSERT_EQUAL_MESSAGE(5, functionSum, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(5, testClass.sum, "T5");
+
+    // Disconnect
+    functionListener.disconnect();
+    TEST_ASSERT_FALSE_MESSAGE(functionListener.connected(), "T6");
+    TEST_ASSERT_FALSE_MESSAGE(event.disconnect(functionListener), "T7");
+
+    event(3);
+    TEST_ASSERT_EQUAL_MESSAGE(5, functionSum, "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(8, testClass.sum, "T9");
+
+    // Batch
+    uint16_t values[] = {1, 2, 3, 4};
+    event.connect(functionListener);
+    event.emitBatch(values, 4);
+    TEST_ASSERT_EQUAL_MESSAGE(15, functionSum, "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(18, testClass.sum, "T11");
+    TEST_ASSERT_EQUAL_MESSAGE(6, testClass.callCounter, "T12");
+
+    // Destroyed Listener disconnects itself
+    {
+        EventFunctionListener<uint16_t> scopedListener(addToSum);
+        event.connect(scopedListener);
+        TEST_ASSERT_EQUAL_MESSAGE(3, event.listenerCount(), "T13");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(2, event.listenerCount(), "T14");
+
+    event.disconnectAll();
+    TEST_ASSERT_TRUE_MESSAGE(event.empty(), "T15");
+    TEST_ASSERT_FALSE_MESSAGE(methodListener.connected(), "T16");
+}
+
+void eventDisconnectWhileEmittingTest() {
+    Event<uint16_t> event;
+    DisconnectingListener first, second, third;
+
+    event.connect(first);
+    event.connect(second);
+    event.connect(third);
+
+    // First disconnects the next Listener -> second must not be called
+    first.toDisconnect = &second;
+    event.emit(0);
+    TEST_ASSERT_EQUAL_MESSAGE(1, first.callCounter, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, second.callCounter, "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(1, third.callCounter, "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(2, event.listenerCount(), "T4");
+
+    // Third disconnects itself while a batch is emitted -> only called once
+    first.toDisconnect = nullptr;
+    third.toDisconnect = &third;
+    uint16_t values[] = {1, 2, 3};
+    event.emitBatch(values, 3);
+    TEST_ASSERT_EQUAL_MESSAGE(4, first.callCounter, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(2, third.callCounter, "T6");
+    TEST_ASSERT_FALSE_MESSAGE(third.connected(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(1, event.listenerCount(), "T8");
+}
+
+void eventConnectWhileEmittingTest() {
+    Event<uint16_t> event;
+    ConnectingListener first(event), second(event), third(event);
+
+    // The last Listener connects a new one -> it is called in the same emit
+    event.connect(first);
+    first.toConnect = &second;
+    event.emit(0);
+    TEST_ASSERT_EQUAL_MESSAGE(1, first.callCounter, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, second.callCounter, "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(2, event.listenerCount(), "T3");
+
+    // Connected from a Listener in the middle -> called after the others
+    second.toConnect = &third;
+    event.emit(0);
+    TEST_ASSERT_EQUAL_MESSAGE(2, first.callCounter, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(2, second.callCounter, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(1, third.callCounter, "T6");
+
+    // Same during a batch, the new Listener gets all values
+    ConnectingListener fourth(event);
+    third.toConnect = &fourth;
+    uint16_t values[] = {1, 2, 3};
+    event.emitBatch(values, 3);
+    TEST_ASSERT_EQUAL_MESSAGE(4, third.callCounter, "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(3, fourth.callCounter, "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(4, event.listenerCount(), "T9");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(eventTest);
+    RUN_TEST(eventDisconnectWhileEmittingTest);
+    RUN_TEST(eventConnectWhileEmittingTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
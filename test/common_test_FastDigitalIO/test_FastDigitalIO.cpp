@@ -0,0 +1,117 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+// Runs on the simulated ports only
+#ifdef USE_NATIVE
+    #include "AbstractionLayer/Native/SimulatedGpio.h"
+    #include "AbstractionLayer/Arduino/PinMode.h"
+    #include "AbstractionLayer/Arduino/DigitalOut.h"
+    #include "AbstractionLayer/Arduino/DigitalIn.h"
+    #include "AbstractionLayer/Arduino/FastDigitalOut.h"
+    #include "AbstractionLayer/Arduino/FastDigitalIn.h"
+
+
+void pinMapTest() {
+    typedef steroido_intern::FastPin<2> D2;
+    typedef steroido_intern::FastPin<13> D13;
+    typedef steroido_intern::FastPin<15> A1;
+
+    TEST_ASSERT_EQUAL_MESSAGE(0x04, D2::mask, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0x20, D13::mask, "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(0x02, A1::mask, "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(&simulatedGpio().ports[SimulatedGpio::PortD], &D2::Port::state(), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(&simulatedGpio().ports[SimulatedGpio::PortB], &D13::Port::state(), "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(&simulatedGpio().ports[SimulatedGpio::PortC], &A1::Port::state(), "T6");
+}
+
+void outputTest() {
+    simulatedGpio().reset();
+
+    // Behaves the same as DigitalOut
+    DigitalOut slow(12);
+    FastDigitalOut<13> fast;
+    TEST_ASSERT_EQUAL_MESSAGE(0x30, simulatedGpio().ports[SimulatedGpio::PortB].direction, "T1");
+
+    uint8_t values[] = {1, 0, 5, 0, 1, 1};
+    for (uint8_t value : values) {
+        slow = value;
+        fast = value;
+        TEST_ASSERT_EQUAL_MESSAGE(simulatedGpio().level(12), simulatedGpio().level(13), "T2");
+        TEST_ASSERT_EQUAL_MESSAGE(slow.read(), fast.read(), "T3");
+        TEST_ASSERT_EQUAL_MESSAGE(value ? 1 : 0, (uint8_t)fast, "T4");
+    }
+
+    fast.toggle();
+    TEST_ASSERT_EQUAL_MESSAGE(0, simulatedGpio().level(13), "T5");
+    fast.toggle();
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(13), "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(12), "T7");
+
+    // The initial value is written
+    FastDigitalOut<3> initial(1);
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().level(3), "T8");
+
+    // A single register access instead of the table lookups of digitalWrite
+    simulatedGpio().accesses = 0;
+    slow.write(0);
+    uint32_t slowAccesses = simulatedGpio().accesses;
+    simulatedGpio().accesses = 0;
+    fast.write(0);
+    TEST_ASSERT_EQUAL_MESSAGE(8, slowAccesses, "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().accesses, "T10");
+
+    simulatedGpio().accesses = 0;
+    fast.toggle();
+    fast.read();
+    TEST_ASSERT_EQUAL_MESSAGE(2, simulatedGpio().accesses, "T11");
+
+    // No RAM
+    TEST_ASSERT_EQUAL_MESSAGE(1, sizeof(fast), "T12");
+}
+
+void inputTest() {
+    simulatedGpio().reset();
+
+    DigitalIn slow(4, PullUp);
+    FastDigitalIn<5> fast(PullUp);
+    FastDigitalIn<14> floating;
+
+    // Pulled up until driven
+    TEST_ASSERT_EQUAL_MESSAGE(1, slow.read(), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, fast.read(), "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(0, floating.read(), "T3");
+
+    simulatedGpio().drive(4, 0);
+    simulatedGpio().drive(5, 0);
+    simulatedGpio().drive(14, 1);
+    TEST_ASSERT_EQUAL_MESSAGE(0, slow.read(), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0, (uint8_t)fast, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(1, floating.read(), "T6");
+
+    simulatedGpio().release(5);
+    TEST_ASSERT_EQUAL_MESSAGE(1, fast.read(), "T7");
+
+    simulatedGpio().accesses = 0;
+    slow.read();
+    uint32_t slowAccesses = simulatedGpio().accesses;
+    simulatedGpio().accesses = 0;
+    fast.read();
+    TEST_ASSERT_EQUAL_MESSAGE(5, slowAccesses, "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(1, simulatedGpio().accesses, "T9");
+}
+
+#endif // USE_NATIVE
+
+
+void setup() {
+    UNITY_BEGIN();
+#ifdef USE_NATIVE
+    RUN_TEST(pinMapTest);
+    RUN_TEST(outputTest);
+    RUN_TEST(inputTest);
+#endif
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
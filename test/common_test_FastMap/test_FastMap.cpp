@@ -0,0 +1,89 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/mapC.h"
+#include "Common/FastMap.h"
+
+
+void linearMapTest() {
+    // Same results as mapC, also outside of the input range and for falling ranges
+    LinearMap<float> adcToVolt(0, 1023, 0, 5);
+    LinearMap<float> inverted(-10, 10, 100, -100);
+    for (int16_t x = -100; x < 1200; x++) {
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, mapC<float>(x, 0, 1023, 0, 5), adcToVolt(x), "T1");
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-3f, mapC<float>(x, -10, 10, 100, -100), inverted.map(x), "T2");
+    }
+}
+
+void fixedLinearMapTest() {
+    // Rounded to the nearest value, mapC truncates
+    FixedLinearMap<int32_t> adcToMillivolt(0, 1023, 0, 5000);
+    FixedLinearMap<int32_t, int32_t> fast(0, 1023, 0, 5000);
+    FixedLinearMap<int32_t> inverted(100, 200, 1000, -1000);
+    for (int32_t x = -100; x < 1200; x++) {
+        int32_t exact = (x * 5000 * 2 + 1023) / (1023 * 2);
+        if (x < 0) exact = -((-x * 5000 * 2 + 1023) / (1023 * 2));
+        TEST_ASSERT_INT_WITHIN_MESSAGE(1, exact, adcToMillivolt(x), "T1");
+        TEST_ASSERT_EQUAL_MESSAGE(adcToMillivolt(x), fast(x), "T2");
+        TEST_ASSERT_INT_WITHIN_MESSAGE(1, mapC<int32_t>(x, 100, 200, 1000, -1000), inverted(x), "T3");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, adcToMillivolt(0), "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(5000, adcToMillivolt(1023), "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(-1000, inverted(200), "T6");
+}
+
+void staticMapTest() {
+    // Usable at compile time
+    static_assert(StaticMap<0, 100, 0, 1000>::map(50) == 500, "StaticMap constexpr");
+
+    for (int16_t x = -100; x < 1200; x++) {
+        TEST_ASSERT_EQUAL_MESSAGE(mapC<int32_t>(x, 0, 1023, 0, 5000), (StaticMap<0, 1023, 0, 5000>::map<int32_t>(x)), "T1");
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-3f, mapC<float>(x, 0, 1023, 5, -5), (StaticMap<0, 1023, 5, -5>::map<float>(x)), "T2");
+    }
+}
+
+void piecewiseLinearMapTest() {
+    // Non-linear calibration curve
+    const float in[] = {0, 100, 200, 400, 1000};
+    const float out[] = {-40, 0, 25, 50, 150};
+    PiecewiseLinearMap<float, 5> curve(in, out);
+
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, -40, curve(0), "T1");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, -20, curve(50), "T2");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, 0, curve(100), "T3");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, 37.5f, curve(300), "T4");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, 100, curve(700), "T5");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, 150, curve(1000), "T6");
+
+    // Clamped outside of the curve
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, -40, curve(-10), "T7");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, 150, curve(5000), "T8");
+
+    // Every segment against mapC
+    for (float x = 0; x < 1000; x += 0.5f) {
+        unsigned int i = 0;
+        while (x >= in[i + 1]) i++;
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-3f, mapC<float>(x, in[i], in[i + 1], out[i], out[i + 1]), curve(x), "T9");
+    }
+
+    // Integers with fixed point segments
+    const int32_t inInt[] = {0, 512, 1023};
+    const int32_t outInt[] = {0, 100, 1100};
+    PiecewiseLinearMap<int32_t, 3, FixedLinearMap<int32_t>> curveInt(inInt, outInt);
+    TEST_ASSERT_EQUAL_MESSAGE(50, curveInt(256), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(100, curveInt(512), "T11");
+    TEST_ASSERT_EQUAL_MESSAGE(1100, curveInt(2000), "T12");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(linearMapTest);
+    RUN_TEST(fixedLinearMapTest);
+    RUN_TEST(staticMapTest);
+    RUN_TEST(piecewiseLinearMapTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,102 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#define STEROIDO_POOL_ALLOCATOR_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/PoolAllocator.h"
+#include "Common/Callback.h"
+#include "Common/vector.h"
+
+
+#define TEST_BLOCK_COUNT 8
+
+uint16_t callCounter = 0;
+
+void callMeFunc() {
+    callCounter++;
+}
+
+class TestClass {
+    public:
+        void callMe() {
+            callCounter++;
+        }
+};
+
+
+void poolAllocatorTest() {
+    PoolAllocator<16, TEST_BLOCK_COUNT> pool;
+    void *blocks[TEST_BLOCK_COUNT];
+
+    // Exhaust the pool
+    for (uint8_t i = 0; i < TEST_BLOCK_COUNT; i++) {
+        blocks[i] = pool.allocate();
+        TEST_ASSERT_NOT_NULL_MESSAGE(blocks[i], "T1");
+        TEST_ASSERT_TRUE_MESSAGE(pool.owns(blocks[i]), "T2");
+    }
+    TEST_ASSERT_NULL_MESSAGE(pool.allocate(), "T3");
+    TEST_ASSERT_EQUAL_MESSAGE(0, pool.available(), "T4");
+
+    // Blocks must not overlap
+    for (uint8_t i = 1; i < TEST_BLOCK_COUNT; i++) {
+        TEST_ASSERT_TRUE_MESSAGE((uint8_t*)blocks[i] - (uint8_t*)blocks[i - 1] >= 16, "T5");
+    }
+
+    // Freed blocks get reused
+    pool.deallocate(blocks[3]);
+    pool.deallocate(blocks[5]);
+    TEST_ASSERT_EQUAL_MESSAGE(2, pool.available(), "T6");
+    TEST_ASSERT_TRUE_MESSAGE(pool.allocate() == blocks[5], "T7");
+    TEST_ASSERT_TRUE_MESSAGE(pool.allocate() == blocks[3], "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(TEST_BLOCK_COUNT, pool.peak(), "T9");
+
+    // Foreign memory
+    uint8_t foreign;
+    TEST_ASSERT_FALSE_MESSAGE(pool.owns(&foreign), "T10");
+}
+
+void globalPoolTest() {
+    SteroidoPool &pool = steroido_intern::globalPool();
+    size_t usedBefore = pool.used();
+
+    {
+        // Callable and instance counter both come from the pool
+        TestClass testClass;
+        Callback<void> methodCallback = callback(testClass, &TestClass::callMe);
+        Callback<void> functionCallback = callback(callMeFunc);
+        Callback<void> copiedCallback = methodCallback;
+
+        TEST_ASSERT_EQUAL_MESSAGE(usedBefore + 4, pool.used(), "T1");
+
+        methodCallback.call();
+        functionCallback.call();
+        copiedCallback.call();
+        TEST_ASSERT_EQUAL_MESSAGE(3, callCounter, "T2");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(usedBefore, pool.used(), "T3");
+
+    // Too big for a block -> heap
+    void *big = steroido_intern::allocate(STEROIDO_POOL_BLOCK_SIZE + 1);
+    TEST_ASSERT_FALSE_MESSAGE(pool.owns(big), "T4");
+    steroido_intern::deallocate(big);
+    TEST_ASSERT_EQUAL_MESSAGE(usedBefore, pool.used(), "T5");
+
+    // Small vectors live in the pool
+    {
+        std::vector<void*> smallVector;
+        smallVector.push_back(nullptr);
+        TEST_ASSERT_TRUE_MESSAGE(pool.owns(smallVector.data()), "T6");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(usedBefore, pool.used(), "T7");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(poolAllocatorTest);
+    RUN_TEST(globalPoolTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,140 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/SPSCCircularBuffer.h"
+
+#ifdef USE_NATIVE
+    #include <thread>
+#endif
+
+
+#define BUFFER_SIZE 10
+#define STRESS_BUFFER_SIZE 64
+#define STRESS_ELEMENT_COUNT 2000000UL
+
+
+void spscCircularBufferTest() {
+    SPSCCircularBuffer<uint16_t, BUFFER_SIZE, uint8_t> buffer;
+    uint16_t value = 0;
+
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T1");
+    TEST_ASSERT_FALSE_MESSAGE(buffer.pop(value), "T2");
+    TEST_ASSERT_FALSE_MESSAGE(buffer.peek(value), "T3");
+
+    // Fill up, the buffer rejects instead of overwriting
+    for (uint16_t i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(buffer.push(i), "T4");
+    }
+    TEST_ASSERT_TRUE_MESSAGE(buffer.full(), "T5");
+    TEST_ASSERT_FALSE_MESSAGE(buffer.push(BUFFER_SIZE), "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(BUFFER_SIZE, buffer.size(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(1, buffer.dropCount(), "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(BUFFER_SIZE, buffer.peakSize(), "T9");
+
+    TEST_ASSERT_TRUE_MESSAGE(buffer.peek(value), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(0, value, "T11");
+
+    // Wrap around multiple times
+    uint16_t expected = 0;
+    for (uint16_t i = BUFFER_SIZE; i < 5 * BUFFER_SIZE; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(buffer.pop(value), "T12");
+        TEST_ASSERT_EQUAL_MESSAGE(expected++, value, "T13");
+        TEST_ASSERT_TRUE_MESSAGE(buffer.push(i), "T14");
+    }
+
+    while (buffer.pop(value)) {
+        TEST_ASSERT_EQUAL_MESSAGE(expected++, value, "T15");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(5 * BUFFER_SIZE, expected, "T16");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T17");
+    TEST_ASSERT_EQUAL_MESSAGE(0, buffer.size(), "T18");
+
+    buffer.resetStatistics();
+    TEST_ASSERT_EQUAL_MESSAGE(0, buffer.dropCount(), "T19");
+    TEST_ASSERT_EQUAL_MESSAGE(0, buffer.peakSize(), "T20");
+}
+
+#ifdef USE_NATIVE
+/**
+ * @brief Producer and consumer run in their own threads, every element has to arrive exactly once
+ * and in order.
+ *
+ */
+void spscCircularBufferStressTest() {
+    static SPSCCircularBuffer<uint32_t, STRESS_BUFFER_SIZE> buffer;
+    uint32_t errorCount = 0;
+    uint32_t received = 0;
+
+    std::thread producer([]() {
+        for (uint32_t i = 0; i < STRESS_ELEMENT_COUNT;) {
+            if (buffer.push(i)) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([&errorCount, &received]() {
+        uint32_t value;
+        while (received < STRESS_ELEMENT_COUNT) {
+            if (buffer.pop(value)) {
+                if (value != received) errorCount++;
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_MESSAGE(STRESS_ELEMENT_COUNT, received, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, errorCount, "T2");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.empty(), "T3");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.peakSize() <= STRESS_BUFFER_SIZE, "T4");
+}
+
+/**
+ * @brief The producer waits for a free place until the timeout
+ *
+ */
+void spscCircularBufferTimeoutTest() {
+    static SPSCCircularBuffer<uint32_t, BUFFER_SIZE> buffer;
+    uint32_t value = 0;
+
+    while (!buffer.full()) buffer.push(value++);
+
+    // Nobody pops -> timeout
+    TEST_ASSERT_FALSE_MESSAGE(buffer.push(value, 1000), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, buffer.dropCount(), "T2");
+
+    // The consumer frees a place in the meantime
+    std::thread consumer([]() {
+        uint32_t popped;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        buffer.pop(popped);
+    });
+
+    TEST_ASSERT_TRUE_MESSAGE(buffer.push(value, 1000000), "T3");
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_MESSAGE(1, buffer.dropCount(), "T4");
+    TEST_ASSERT_TRUE_MESSAGE(buffer.full(), "T5");
+}
+#endif
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(spscCircularBufferTest);
+    #ifdef USE_NATIVE
+        RUN_TEST(spscCircularBufferStressTest);
+        RUN_TEST(spscCircularBufferTimeoutTest);
+    #endif
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
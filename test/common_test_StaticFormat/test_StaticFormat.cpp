@@ -0,0 +1,85 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/StaticFormat.h"
+
+
+char text[96];
+char expected[96];
+
+enum Color { Red, Green, Blue };
+enum class Level : int8_t { Low = -1, High = 1 };
+
+char output[16];
+size_t outputLength = 0;
+
+// Collects the output of staticPrintf
+void _putchar(char character) {
+    if (outputLength < sizeof(output) - 1) output[outputLength++] = character;
+    output[outputLength] = 0;
+}
+
+
+void sameAsPrintfTest() {
+    int value = -42;
+    const char *name = "motor";
+
+    // Same output as the runtime parsed snprintf
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%s: %d|%5d|%-5d|%05d|%+d|% d"), name, value, value, value, value, 7, 7);
+    snprintf_(expected, sizeof(expected), "%s: %d|%5d|%-5d|%05d|%+d|% d", name, value, value, value, value, 7, 7);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, text, "T1");
+
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%u %x %#X %o %#b %.4u %c|%-3c|"), 4000000000u, 0xbeefu, 0xabcu, 8u, 5u, 7u, 'a', 'b');
+    snprintf_(expected, sizeof(expected), "%u %x %#X %o %#b %.4u %c|%-3c|", 4000000000u, 0xbeefu, 0xabcu, 8u, 5u, 7u, 'a', 'b');
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, text, "T2");
+
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%f %.2f %8.3f %-8.1f| %e %g 100%%"), 3.25, -0.005f, 2.5, 1.25, 12345.678, 0.0001);
+    snprintf_(expected, sizeof(expected), "%f %.2f %8.3f %-8.1f| %e %g 100%%", 3.25, -0.005f, 2.5, 1.25, 12345.678, 0.0001);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, text, "T3");
+
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("[%8s|%-8s|%.2s] %p"), "ab", "cd", "efgh", (void*)name);
+    snprintf_(expected, sizeof(expected), "[%8s|%-8s|%.2s] %p", "ab", "cd", "efgh", (void*)name);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, text, "T4");
+
+    // Length modifiers are accepted, the type of the argument decides
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%lld %llu %lu %hhu %zu"), (int64_t)-1, (uint64_t)18446744073709551615ull, 4000000000ul, (uint8_t)200, sizeof(uint32_t));
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("-1 18446744073709551615 4000000000 200 4", text, "T5");
+}
+
+void typedTest() {
+    // Integers are formatted as their own type
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%u %x %d %u"), (int8_t)-1, (int16_t)-1, (uint8_t)255, (int32_t)-1);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("255 ffff 255 4294967295", text, "T1");
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%d %d %d"), INT8_MIN, INT32_MIN, INT64_MIN);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("-128 -2147483648 -9223372036854775808", text, "T2");
+
+    // volatile values (e.g. registers or variables shared with interrupts) and enums
+    volatile uint16_t counter = 65535;
+    const volatile int8_t offset = -3;
+    volatile char letter = 'v';
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%u %d %c"), counter, offset, letter);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("65535 -3 v", text, "T9");
+    const Level level = Level::Low;
+    staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("%d %d %u %x"), Blue, level, Level::Low, Green);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("2 -1 255 1", text, "T10");
+
+    // Cut off like snprintf, the full length is returned
+    TEST_ASSERT_EQUAL_MESSAGE(10, staticSnprintf(text, 6, STEROIDO_FORMAT("abc%d%s"), 12345, "67"), "T3");
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("abc12", text, "T4");
+    TEST_ASSERT_EQUAL_MESSAGE(0, staticSnprintf(text, sizeof(text), STEROIDO_FORMAT("")), "T5");
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("", text, "T6");
+
+    TEST_ASSERT_EQUAL_MESSAGE(9, staticPrintf(STEROIDO_FORMAT("%s=%03u"), "speed", 7u), "T7");
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("speed=007", output, "T8");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(sameAsPrintfTest);
+    RUN_TEST(typedTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
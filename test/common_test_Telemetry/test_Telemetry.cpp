@@ -0,0 +1,203 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Communication/Telemetry.h"
+
+
+#define SINK_SIZE 1024
+
+
+/**
+ * @brief Collects the written bytes, accepts at most limit bytes per write
+ *
+ */
+class MemorySink : public IByteSink {
+    public:
+        size_t write(const uint8_t *data, size_t length) override {
+            if (length > limit) length = limit;
+            if (length > SINK_SIZE - size) length = SINK_SIZE - size;
+            memcpy(bytes + size, data, length);
+            size += length;
+            return length;
+        }
+
+        uint8_t bytes[SINK_SIZE];
+        size_t size = 0;
+        size_t limit = SINK_SIZE;
+};
+
+/**
+ * @brief Decode the next frame of the stream and check its CRC
+ *
+ * @return size_t Length of the frame without the CRC, 0 if there is none or it is invalid
+ */
+size_t nextFrame(const MemorySink &sink, size_t &position, uint8_t *frame) {
+    size_t end = position;
+    while (end < sink.size && sink.bytes[end]) end++;
+    if (end >= sink.size) return 0;
+
+    size_t length = cobsDecode(sink.bytes + position, end - position, frame, 256);
+    position = end + 1;
+    if (length < 3) return 0;
+
+    length -= 2;
+    uint16_t crc = crc16(frame, length);
+    if (frame[length] != (crc & 0xFF) || frame[length + 1] != crc >> 8) return 0;
+    return length;
+}
+
+
+void crcAndCobsTest() {
+    TEST_ASSERT_EQUAL_MESSAGE(0x29B1, crc16((const uint8_t*)"123456789", 9), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0x29B1, crc16((const uint8_t*)"6789", 4, crc16((const uint8_t*)"12345", 5)), "T2");
+
+    uint8_t data[600];
+    uint8_t encoded[cobsMaxEncodedLength(600)];
+    uint8_t decoded[600];
+
+    // Zeros are replaced, a run of more than 254 other bytes needs an extra code byte
+    const uint8_t zeros[] = {0, 0x11, 0, 0};
+    const uint8_t zerosEncoded[] = {1, 2, 0x11, 1, 1};
+    TEST_ASSERT_EQUAL_MESSAGE(5, cobsEncode(zeros, 4, encoded), "T3");
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(zerosEncoded, encoded, 5) == 0, "T4");
+
+    for (size_t i = 0; i < sizeof(data); i++) data[i] = i % 300 < 260 ? (i % 251) + 1 : 0;
+    size_t lengths[] = {0, 1, 253, 254, 255, 300, 600};
+    for (size_t length : lengths) {
+        size_t encodedLength = cobsEncode(data, length, encoded);
+        TEST_ASSERT_TRUE_MESSAGE(encodedLength <= cobsMaxEncodedLength(length), "T5");
+        TEST_ASSERT_NULL_MESSAGE(memchr(encoded, 0, encodedLength), "T6");
+        TEST_ASSERT_EQUAL_MESSAGE(length, cobsDecode(encoded, encodedLength, decoded, sizeof(decoded)), "T7");
+        TEST_ASSERT_TRUE_MESSAGE(memcmp(data, decoded, length) == 0, "T8");
+    }
+
+    // Invalid frames and too small outputs are rejected
+    const uint8_t invalid[] = {3, 0x11};
+    TEST_ASSERT_EQUAL_MESSAGE(0, cobsDecode(invalid, 2, decoded, sizeof(decoded)), "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(0, cobsDecode(zerosEncoded, 5, decoded, 3), "T10");
+}
+
+void frameTest() {
+    MemorySink sink;
+    Telemetry<4, 34, 128> telemetry(sink);
+    uint8_t frame[256];
+    size_t position = 0;
+
+    TelemetryChannel<float> voltage = telemetry.addChannel<float>("voltage");
+    TelemetryChannel<int16_t> current = telemetry.addChannel<int16_t>("current");
+    TEST_ASSERT_EQUAL_MESSAGE(0, voltage.id, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(1, current.id, "T2");
+
+    telemetry.timestamp(1000);
+    TEST_ASSERT_TRUE_MESSAGE(telemetry.sample(voltage, 3.25f), "T3");
+    TEST_ASSERT_TRUE_MESSAGE(telemetry.sample(current, -2), "T4");
+    TEST_ASSERT_FALSE_MESSAGE(telemetry.sample(TelemetryChannel<float>(), 1.0f), "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(0, telemetry.pending(), "T6");
+
+    // The channels are sent before the first samples
+    telemetry.call();
+    TEST_ASSERT_EQUAL_MESSAGE(0, telemetry.pending(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(10, nextFrame(sink, position, frame), "T8");
+    const uint8_t voltageChannel[] = {TelemetryChannelInfo, 0, 'f', 'v', 'o', 'l', 't', 'a', 'g', 'e'};
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(voltageChannel, frame, 10) == 0, "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(10, nextFrame(sink, position, frame), "T10");
+    const uint8_t currentChannel[] = {TelemetryChannelInfo, 1, 'h', 'c', 'u', 'r', 'r', 'e', 'n', 't'};
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(currentChannel, frame, 10) == 0, "T11");
+
+    const uint8_t samples[] = {TelemetrySamples, 0, TelemetryTimestamp, 0xE8, 3, 0, 0, 0, 0, 0, 0x50, 0x40, 1, 0xFE, 0xFF};
+    TEST_ASSERT_EQUAL_MESSAGE(sizeof(samples), nextFrame(sink, position, frame), "T12");
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(samples, frame, sizeof(samples)) == 0, "T13");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T14");
+
+    // Full frames are sent right away, the channels only once
+    for (int16_t i = 0; i < 10; i++) telemetry.sample(current, i);
+    TEST_ASSERT_EQUAL_MESSAGE(0, telemetry.pending(), "T15");
+    for (int16_t i = 10; i < 20; i++) telemetry.sample(current, i);
+    telemetry.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(2 + 10 * 3, nextFrame(sink, position, frame), "T16");
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetrySamples, frame[0], "T17");
+    TEST_ASSERT_EQUAL_MESSAGE(1, frame[1], "T18");
+    TEST_ASSERT_EQUAL_MESSAGE(9, frame[2 + 9 * 3 + 1], "T19");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T20");
+
+    telemetry.flush();
+    telemetry.drain();
+    TEST_ASSERT_EQUAL_MESSAGE(2 + 10 * 3, nextFrame(sink, position, frame), "T21");
+    TEST_ASSERT_EQUAL_MESSAGE(2, frame[1], "T22");
+    TEST_ASSERT_EQUAL_MESSAGE(10, frame[2 + 1], "T23");
+
+    // Until they are reset
+    telemetry.resendChannels();
+    telemetry.sample(voltage, 0.0f);
+    telemetry.call();
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetryChannelInfo, (nextFrame(sink, position, frame), frame[0]), "T24");
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetryChannelInfo, (nextFrame(sink, position, frame), frame[0]), "T25");
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetrySamples, (nextFrame(sink, position, frame), frame[0]), "T26");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T27");
+
+    // And again after the sequence wrapped around, for a host connecting later
+    for (uint16_t i = 4; i < 256; i++) {
+        sink.size = position = 0;
+        telemetry.sample(voltage, 3.3);
+        telemetry.call();
+        TEST_ASSERT_EQUAL_MESSAGE(TelemetrySamples, (nextFrame(sink, position, frame), frame[0]), "T28");
+    }
+    sink.size = position = 0;
+    telemetry.sample(voltage, 3.3);
+    telemetry.call();
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetryChannelInfo, (nextFrame(sink, position, frame), frame[0]), "T29");
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetryChannelInfo, (nextFrame(sink, position, frame), frame[0]), "T30");
+    TEST_ASSERT_EQUAL_MESSAGE(2 + 5, nextFrame(sink, position, frame), "T31");
+    TEST_ASSERT_EQUAL_MESSAGE(0, frame[1], "T32");
+    float value;
+    memcpy(&value, frame + 3, 4);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(3.3f, value, "T33");
+}
+
+void dropTest() {
+    MemorySink sink;
+    Telemetry<2, 16, 40> telemetry(sink);
+    uint8_t frame[256];
+    size_t position = 0;
+
+    TelemetryChannel<uint32_t> counter = telemetry.addChannel<uint32_t>("n");
+    TelemetryChannel<uint8_t> unused = telemetry.addChannel<uint8_t>("unused");
+    TEST_ASSERT_EQUAL_MESSAGE(TelemetryNoChannel, telemetry.addChannel<double>("too many").id, "T1");
+    (void)unused;
+
+    // Each frame takes 2 + 2 * 5 + 2 bytes, framed 16 bytes. The channels take 8 and 13 bytes.
+    for (uint32_t i = 0; i < 8; i++) telemetry.sample(counter, i);
+    TEST_ASSERT_EQUAL_MESSAGE(2, telemetry.droppedFrames(), "T2");
+    TEST_ASSERT_EQUAL_MESSAGE(37, telemetry.pending(), "T3");
+
+    // call() does not send the unfinished frame while the buffer is busy
+    sink.limit = 8;
+    telemetry.call();
+    TEST_ASSERT_EQUAL_MESSAGE(29, telemetry.pending(), "T4");
+    sink.limit = SINK_SIZE;
+    telemetry.call();
+    TEST_ASSERT_EQUAL_MESSAGE(0, telemetry.pending(), "T5");
+    telemetry.call();
+
+    // The sequence shows the lost frames
+    nextFrame(sink, position, frame);
+    nextFrame(sink, position, frame);
+    TEST_ASSERT_EQUAL_MESSAGE(2 + 2 * 5, nextFrame(sink, position, frame), "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(0, frame[1], "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(2 + 2 * 5, nextFrame(sink, position, frame), "T8");
+    TEST_ASSERT_EQUAL_MESSAGE(3, frame[1], "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(6, frame[3], "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(sink.size, position, "T11");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(crcAndCobsTest);
+    RUN_TEST(frameTest);
+    RUN_TEST(dropTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,126 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/WindowStatistics.h"
+
+
+#define WINDOW_SIZE 10
+#define SAMPLE_COUNT 1000
+
+
+/**
+ * @brief Deterministic pseudo random numbers, so a failing run can be reproduced
+ *
+ */
+uint16_t nextRandom() {
+    static uint32_t state = 12345;
+    state = state * 1103515245UL + 12345UL;
+    return (state >> 16) & 0x7FFF;
+}
+
+/**
+ * @brief Compare the incremental statistics with a full recalculation over the window
+ *
+ * @tparam T
+ * @tparam SumType
+ * @param statistics
+ * @param tolerance allowed deviation of the mean/variance
+ */
+template<typename T, typename SumType>
+void checkWindow(const WindowStatistics<T, WINDOW_SIZE, SumType> &statistics, float tolerance) {
+    SumType sum = 0;
+    T minimum = *statistics.window().begin();
+    T maximum = minimum;
+
+    for (const T &value : statistics.window()) {
+        sum += value;
+        if (value < minimum) minimum = value;
+        if (value > maximum) maximum = value;
+    }
+
+    float mean = (float)sum / statistics.size();
+    float variance = 0;
+    for (const T &value : statistics.window()) {
+        variance += ((float)value - mean) * ((float)value - mean);
+    }
+    variance /= statistics.size();
+
+    TEST_ASSERT_TRUE_MESSAGE(minimum == statistics.min(), "C1");
+    TEST_ASSERT_TRUE_MESSAGE(maximum == statistics.max(), "C2");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(tolerance, mean, statistics.mean(), "C3");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(tolerance * (1 + variance), variance, statistics.variance(), "C4");
+}
+
+void integerStatisticsTest() {
+    WindowStatistics<int16_t, WINDOW_SIZE, int32_t> statistics;
+
+    TEST_ASSERT_TRUE_MESSAGE(statistics.empty(), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, statistics.sum(), "T2");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0, statistics.mean(), "T3");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0, statistics.variance(), "T4");
+
+    // Fixed values: the min leaves the window first, then the max
+    const int16_t values[] = {-5, 7, 3, 3, 1, 9, 2, 2, 0, 4};
+    for (int16_t value : values) statistics.push(value);
+
+    TEST_ASSERT_TRUE_MESSAGE(statistics.full(), "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(26, statistics.sum(), "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(-5, statistics.min(), "T7");
+    TEST_ASSERT_EQUAL_MESSAGE(9, statistics.max(), "T8");
+
+    statistics.push(4);
+    TEST_ASSERT_EQUAL_MESSAGE(35, statistics.sum(), "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(0, statistics.min(), "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(9, statistics.max(), "T11");
+
+    // Random values, many of them equal, wrapping the window over and over again
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        statistics.push((int16_t)(nextRandom() % 64) - 32);
+        checkWindow(statistics, 0.01f);
+    }
+
+    statistics.reset();
+    TEST_ASSERT_TRUE_MESSAGE(statistics.empty(), "T12");
+    TEST_ASSERT_EQUAL_MESSAGE(0, statistics.sum(), "T13");
+
+    statistics.push(3);
+    TEST_ASSERT_EQUAL_MESSAGE(3, statistics.min(), "T14");
+    TEST_ASSERT_EQUAL_MESSAGE(3, statistics.max(), "T15");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(3, statistics.mean(), "T16");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0, statistics.variance(), "T17");
+
+    // Small integers are summed in 32 bit
+    WindowStatistics<uint8_t, 300> bytes;
+    for (uint16_t i = 0; i < 300; i++) bytes.push(250);
+    TEST_ASSERT_EQUAL_MESSAGE(75000, bytes.sum(), "T18");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(250, bytes.mean(), "T19");
+}
+
+void floatStatisticsTest() {
+    WindowStatistics<float, WINDOW_SIZE, float> statistics;
+
+    // Slowly rising signal with noise, like a warming up sensor
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) {
+        statistics.push(20.0f + i * 0.01f + (nextRandom() % 100) * 0.001f);
+        checkWindow(statistics, 0.001f);
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(statistics.full(), "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(WINDOW_SIZE, statistics.size(), "T2");
+
+    // Large values leave rounding errors behind, small values afterwards are exact again
+    for (uint16_t i = 0; i < SAMPLE_COUNT; i++) statistics.push(10000.0f + (nextRandom() % 100));
+    for (uint16_t i = 0; i < 2 * WINDOW_SIZE; i++) statistics.push((nextRandom() % 100) * 0.01f);
+    checkWindow(statistics, 0.001f);
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(integerStatisticsTest);
+    RUN_TEST(floatStatisticsTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,130 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+
+#define ELEMENT_COUNT 300
+
+
+/**
+ * @brief Counts its assignments, so the element-wise path can be checked
+ *
+ */
+class countedObject {
+    public:
+        static uint16_t assignments;
+
+        countedObject() : value(0) {}
+
+        countedObject(uint32_t value) : value(value) {}
+
+        countedObject& operator=(const countedObject &that) {
+            value = that.value;
+            assignments++;
+            return *this;
+        }
+
+        uint32_t value;
+};
+
+uint16_t countedObject::assignments = 0;
+
+struct paddedStruct {
+    uint8_t a;
+    uint32_t b;
+};
+
+
+void memCpyTest() {
+    uint8_t bytesSrc[ELEMENT_COUNT + 3];
+    uint8_t bytesDest[ELEMENT_COUNT + 3];
+    for (uint16_t i = 0; i < ELEMENT_COUNT + 3; i++) bytesSrc[i] = i * 7;
+
+    // Unaligned source and destination, the returned pointer is behind the copied elements
+    memSet<uint8_t>(bytesDest, 0, sizeof(bytesDest));
+    uint8_t *end = memCpy<uint8_t>(bytesDest + 1, bytesSrc + 3, ELEMENT_COUNT);
+    TEST_ASSERT_TRUE_MESSAGE(end == bytesDest + 1 + ELEMENT_COUNT, "T1");
+    TEST_ASSERT_EQUAL_MESSAGE(0, bytesDest[0], "T2");
+    for (uint16_t i = 0; i < ELEMENT_COUNT; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(bytesSrc[i + 3], bytesDest[i + 1], "T3");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, bytesDest[ELEMENT_COUNT + 1], "T4");
+
+    // Nothing to copy
+    TEST_ASSERT_TRUE_MESSAGE(memCpy<uint8_t>(bytesDest, bytesSrc, 0) == bytesDest, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(0, bytesDest[0], "T6");
+
+    // Trivially copyable structs
+    paddedStruct structSrc[5];
+    paddedStruct structDest[5];
+    for (uint16_t i = 0; i < 5; i++) structSrc[i] = {static_cast<uint8_t>(i), i * 1000u};
+    memCpyN<paddedStruct>(structDest, structSrc, 5);
+    for (uint16_t i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(i, structDest[i].a, "T7");
+        TEST_ASSERT_EQUAL_MESSAGE(i * 1000u, structDest[i].b, "T8");
+    }
+
+    // Non trivial objects are assigned one by one
+    countedObject objectSrc[10];
+    countedObject objectDest[10];
+    for (uint16_t i = 0; i < 10; i++) objectSrc[i].value = i + 1;
+    countedObject::assignments = 0;
+    TEST_ASSERT_TRUE_MESSAGE(memCpy<countedObject>(objectDest, objectSrc, 10) == objectDest + 10, "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(10, countedObject::assignments, "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(10, objectDest[9].value, "T11");
+
+    // Overlapping ranges, e.g. shifting the elements of an array
+    for (uint16_t i = 0; i < ELEMENT_COUNT + 3; i++) bytesSrc[i] = i;
+    memCpy<uint8_t>(bytesSrc, bytesSrc + 3, ELEMENT_COUNT);
+    for (uint16_t i = 0; i < ELEMENT_COUNT; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE((uint8_t)(i + 3), bytesSrc[i], "T12");
+    }
+    for (uint16_t i = 0; i < 10; i++) structSrc[i % 5].b = i;
+    memCpy<paddedStruct>(structSrc + 1, structSrc, 4);
+    for (uint16_t i = 1; i < 5; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(i + 4, structSrc[i].b, "T13");
+    }
+}
+
+void memSetTest() {
+    uint32_t words[ELEMENT_COUNT + 1];
+
+    // Value with equal bytes (memset) and other values (copied), for several lengths
+    const uint32_t values[] = {0, 0xABABABAB, 0x12345678};
+    const uint16_t counts[] = {0, 1, 15, 16, 17, 100, ELEMENT_COUNT};
+    for (uint32_t value : values) {
+        for (uint16_t count : counts) {
+            memSet<uint32_t>(words, 0xFFFFFFFF, ELEMENT_COUNT + 1);
+            uint32_t *end = memSet<uint32_t>(words, value, count);
+            TEST_ASSERT_TRUE_MESSAGE(end == words + count, "T1");
+            for (uint16_t i = 0; i < count; i++) {
+                TEST_ASSERT_EQUAL_MESSAGE(value, words[i], "T2");
+            }
+            TEST_ASSERT_EQUAL_MESSAGE(0xFFFFFFFF, words[count], "T3");
+        }
+    }
+
+    // Bytes
+    uint8_t bytes[ELEMENT_COUNT];
+    memSet<uint8_t>(bytes, 0x5A, ELEMENT_COUNT);
+    for (uint16_t i = 0; i < ELEMENT_COUNT; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(0x5A, bytes[i], "T4");
+    }
+
+    // Non trivial objects are assigned one by one
+    countedObject objects[10];
+    countedObject::assignments = 0;
+    memSet<countedObject>(objects, countedObject(42), 10);
+    TEST_ASSERT_EQUAL_MESSAGE(10, countedObject::assignments, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(42, objects[9].value, "T6");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(memCpyTest);
+    RUN_TEST(memSetTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
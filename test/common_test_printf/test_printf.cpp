@@ -0,0 +1,61 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Libraries/printf/printf.h"
+
+
+// Required by the printf library, unused here
+void _putchar(char) {}
+
+char text[64];
+
+
+void integerTest() {
+    sprintf_(text, "%u", 0u);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0", text, "T1");
+    sprintf_(text, "%u|%d|%5d|%-5d|%05d", 4294967295u, -7, 42, 42, -42);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("4294967295|-7|   42|42   |-0042", text, "T2");
+    sprintf_(text, "%llu", 18446744073709551615ull);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("18446744073709551615", text, "T3");
+    sprintf_(text, "%lld", -9000000000000000001ll);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("-9000000000000000001", text, "T4");
+    sprintf_(text, "%llu", 100000000000000000ull);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("100000000000000000", text, "T5");
+    sprintf_(text, "%.4u|%.0u|%+d", 7u, 0u, 5);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0007||+5", text, "T6");
+    sprintf_(text, "%x|%#X|%o|%b|%08llx", 0xbeefu, 0xabcu, 8u, 5u, 0x1full);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("beef|0XABC|10|101|0000001f", text, "T7");
+}
+
+void floatTest() {
+    sprintf_(text, "%f|%.2f|%.0f", 3.25, -0.005, 123456.5);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("3.250000|-0.01|123456", text, "T1");
+
+    // Exact halves round to even, everything else to the nearest
+    sprintf_(text, "%.0f %.0f %.0f %.2f %.3f", 0.5, 1.5, 2.5, 0.125, 0.0625);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0 2 2 0.12 0.062", text, "T2");
+    sprintf_(text, "%.1f %.2f %.1f", 0.95, 1.005, 0.25000001);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0.9 1.00 0.3", text, "T3");
+
+    // Rollover into the whole part
+    sprintf_(text, "%.1f|%.9f|%.2f", 9.96, 0.9999999999, 999999999.999);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("10.0|1.000000000|1000000000.00", text, "T4");
+
+    sprintf_(text, "%.9f|%.3f|%.4f", 1e-9, 1e-300, 5e-324);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0.000000001|0.000|0.0000", text, "T5");
+    sprintf_(text, "%8.3f|%-8.1f|%08.2f|%+.1f", 3.14159, 2.0, -1.5, 7.0);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("   3.142|2.0     |-0001.50|+7.0", text, "T6");
+    sprintf_(text, "%.3f", (double)0.1f);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("0.100", text, "T7");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(integerTest);
+    RUN_TEST(floatTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
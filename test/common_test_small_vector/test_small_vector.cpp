@@ -0,0 +1,117 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/small_vector.h"
+
+
+#define INLINE_COUNT 4
+#define ELEMENT_ADD_COUNT 64
+
+
+/**
+ * @brief Counts the living objects to check the object lifetimes in the vector
+ *
+ */
+class trackedObject {
+    public:
+        static int16_t alive;
+
+        trackedObject(uint16_t id) : id(id) {
+            alive++;
+        }
+
+        trackedObject(const trackedObject &that) : id(that.id) {
+            alive++;
+        }
+
+        trackedObject(trackedObject &&that) : id(that.id) {
+            that.id = 0xFFFF;
+            alive++;
+        }
+
+        trackedObject& operator=(const trackedObject &that) {
+            id = that.id;
+            return *this;
+        }
+
+        trackedObject& operator=(trackedObject &&that) {
+            id = that.id;
+            that.id = 0xFFFF;
+            return *this;
+        }
+
+        ~trackedObject() {
+            alive--;
+        }
+
+        uint16_t id;
+};
+
+int16_t trackedObject::alive = 0;
+
+
+void smallVectorTest() {
+    {
+        small_vector<trackedObject, INLINE_COUNT> objects;
+
+        TEST_ASSERT_TRUE_MESSAGE(objects.empty(), "T1");
+        TEST_ASSERT_TRUE_MESSAGE(objects.is_inline(), "T2");
+        TEST_ASSERT_EQUAL_MESSAGE(INLINE_COUNT, objects.capacity(), "T3");
+
+        // Up to N elements stay inline
+        for (uint16_t i = 0; i < INLINE_COUNT; i++) {
+            objects.emplace_back(i);
+        }
+        TEST_ASSERT_TRUE_MESSAGE(objects.is_inline(), "T4");
+        TEST_ASSERT_EQUAL_MESSAGE(INLINE_COUNT, objects.capacity(), "T5");
+
+        // One more spills to the heap
+        objects.push_back(trackedObject(INLINE_COUNT));
+        TEST_ASSERT_FALSE_MESSAGE(objects.is_inline(), "T6");
+        for (uint16_t i = INLINE_COUNT + 1; i < ELEMENT_ADD_COUNT; i++) {
+            objects.emplace_back(i);
+        }
+
+        uint16_t i = 0;
+        for (const trackedObject &object : objects) {
+            TEST_ASSERT_EQUAL_MESSAGE(i++, object.id, "T7");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(ELEMENT_ADD_COUNT, trackedObject::alive, "T8");
+
+        // Shrinking below N moves the elements back inline
+        while (objects.size() > INLINE_COUNT - 1) objects.erase(objects.begin());
+        objects.shrink_to_fit();
+        TEST_ASSERT_TRUE_MESSAGE(objects.is_inline(), "T9");
+        TEST_ASSERT_EQUAL_MESSAGE(INLINE_COUNT, objects.capacity(), "T10");
+        TEST_ASSERT_EQUAL_MESSAGE(INLINE_COUNT - 1, trackedObject::alive, "T11");
+
+        objects.insert(objects.begin(), trackedObject(100));
+        TEST_ASSERT_TRUE_MESSAGE(objects.is_inline(), "T12");
+        TEST_ASSERT_EQUAL_MESSAGE(100, objects.front().id, "T13");
+        TEST_ASSERT_EQUAL_MESSAGE(ELEMENT_ADD_COUNT - 1, objects.back().id, "T14");
+
+        // clear() keeps the inline storage usable
+        objects.clear();
+        TEST_ASSERT_TRUE_MESSAGE(objects.is_inline(), "T15");
+        TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T16");
+        objects.emplace_back(1);
+    }
+
+    // Everything got destroyed exactly once
+    TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T17");
+
+    // Reserving more than N goes to the heap right away
+    small_vector<uint32_t, INLINE_COUNT> values(2 * INLINE_COUNT);
+    TEST_ASSERT_FALSE_MESSAGE(values.is_inline(), "T18");
+    TEST_ASSERT_EQUAL_MESSAGE(2 * INLINE_COUNT, values.capacity(), "T19");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(smallVectorTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -0,0 +1,179 @@
+#ifdef STEROIDO_UNIT_TEST_ENABLED
+
+#include "Common/TestingHeader.h"
+
+#include "Common/static_vector.h"
+
+// Scheduler lists backed by static_vector
+#define STEROIDO_SCHEDULER_STATIC_CAPACITY 2
+
+#include "OS/ICallable.h"
+#include "OS/ScheduledCallable.h"
+#include "OS/Scheduler.h"
+
+
+#define VECTOR_CAPACITY 8
+
+
+/**
+ * @brief Counts the living objects to check the object lifetimes in the vector
+ *
+ */
+class trackedObject {
+    public:
+        static int16_t alive;
+
+        trackedObject(uint16_t id) : id(id) {
+            alive++;
+        }
+
+        trackedObject(const trackedObject &that) : id(that.id) {
+            alive++;
+        }
+
+        trackedObject& operator=(const trackedObject &that) {
+            id = that.id;
+            return *this;
+        }
+
+        ~trackedObject() {
+            alive--;
+        }
+
+        uint16_t id;
+};
+
+int16_t trackedObject::alive = 0;
+
+
+class CountingCallable : public ICallable {
+    public:
+        void call() {
+            callCount++;
+        }
+
+        uint16_t callCount = 0;
+};
+
+
+void staticVectorTest() {
+    {
+        static_vector<trackedObject, VECTOR_CAPACITY> objects;
+
+        TEST_ASSERT_TRUE_MESSAGE(objects.empty(), "T1");
+        TEST_ASSERT_EQUAL_MESSAGE(VECTOR_CAPACITY, objects.capacity(), "T2");
+
+        for (uint16_t i = 0; i < VECTOR_CAPACITY; i++) {
+            TEST_ASSERT_TRUE_MESSAGE(objects.emplace_back(i), "T3");
+        }
+
+        // Full: adding fails without touching the elements
+        TEST_ASSERT_TRUE_MESSAGE(objects.full(), "T4");
+        TEST_ASSERT_FALSE_MESSAGE(objects.push_back(trackedObject(100)), "T5");
+        TEST_ASSERT_FALSE_MESSAGE(objects.emplace_back(100), "T6");
+        TEST_ASSERT_TRUE_MESSAGE(objects.insert(objects.begin(), trackedObject(100)) == objects.end(), "T7");
+        TEST_ASSERT_EQUAL_MESSAGE(VECTOR_CAPACITY, objects.size(), "T8");
+        TEST_ASSERT_EQUAL_MESSAGE(VECTOR_CAPACITY, trackedObject::alive, "T9");
+
+        uint16_t i = 0;
+        for (const trackedObject &object : objects) {
+            TEST_ASSERT_EQUAL_MESSAGE(i++, object.id, "T10");
+        }
+
+        // Reserving more fails silently, shrinking keeps the capacity
+        objects.reserve(2 * VECTOR_CAPACITY);
+        objects.shrink_to_fit();
+        TEST_ASSERT_EQUAL_MESSAGE(VECTOR_CAPACITY, objects.capacity(), "T11");
+
+        objects.erase(objects.begin() + 1);
+        TEST_ASSERT_FALSE_MESSAGE(objects.full(), "T12");
+        auto inserted = objects.insert(objects.begin(), trackedObject(100));
+        TEST_ASSERT_TRUE_MESSAGE(inserted == objects.begin(), "T13");
+        TEST_ASSERT_EQUAL_MESSAGE(100, objects[0].id, "T14");
+        TEST_ASSERT_EQUAL_MESSAGE(0, objects[1].id, "T15");
+        TEST_ASSERT_EQUAL_MESSAGE(2, objects[2].id, "T16");
+        TEST_ASSERT_EQUAL_MESSAGE(VECTOR_CAPACITY, trackedObject::alive, "T17");
+
+        objects.clear();
+        TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T18");
+        TEST_ASSERT_TRUE_MESSAGE(objects.push_back(trackedObject(1)), "T19");
+    }
+
+    // Everything got destroyed exactly once
+    TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T20");
+}
+
+void staticVectorBulkInsertTest() {
+    {
+        static_vector<trackedObject, VECTOR_CAPACITY> objects;
+        objects.emplace_back(0);
+        objects.emplace_back(1);
+
+        // Fill
+        auto inserted = objects.insert(objects.begin() + 1, 3, trackedObject(7));
+        TEST_ASSERT_TRUE_MESSAGE(inserted == objects.begin() + 1, "T1");
+        TEST_ASSERT_EQUAL_MESSAGE(5, objects.size(), "T2");
+        const uint16_t filled[] = {0, 7, 7, 7, 1};
+        for (uint16_t i = 0; i < 5; i++) {
+            TEST_ASSERT_EQUAL_MESSAGE(filled[i], objects[i].id, "T3");
+        }
+
+        // Range
+        const trackedObject range[] = {trackedObject(10), trackedObject(11)};
+        inserted = objects.insert(objects.end(), range, range + 2);
+        TEST_ASSERT_TRUE_MESSAGE(inserted == objects.begin() + 5, "T4");
+        TEST_ASSERT_EQUAL_MESSAGE(7, objects.size(), "T5");
+        TEST_ASSERT_EQUAL_MESSAGE(10, objects[5].id, "T6");
+        TEST_ASSERT_EQUAL_MESSAGE(11, objects[6].id, "T7");
+        TEST_ASSERT_EQUAL_MESSAGE(9, trackedObject::alive, "T8");
+
+        // Overflow: nothing is inserted
+        TEST_ASSERT_TRUE_MESSAGE(objects.insert(objects.begin(), 2, trackedObject(20)) == objects.end(), "T9");
+        TEST_ASSERT_TRUE_MESSAGE(objects.insert(objects.begin(), range, range + 2) == objects.end(), "T10");
+        TEST_ASSERT_EQUAL_MESSAGE(7, objects.size(), "T11");
+        TEST_ASSERT_EQUAL_MESSAGE(0, objects[0].id, "T12");
+        TEST_ASSERT_EQUAL_MESSAGE(9, trackedObject::alive, "T13");
+
+        // Exactly full
+        TEST_ASSERT_TRUE_MESSAGE(objects.insert(objects.begin(), 1, trackedObject(20)) == objects.begin(), "T14");
+        TEST_ASSERT_TRUE_MESSAGE(objects.full(), "T15");
+        TEST_ASSERT_EQUAL_MESSAGE(20, objects[0].id, "T16");
+        TEST_ASSERT_EQUAL_MESSAGE(11, objects[VECTOR_CAPACITY - 1].id, "T17");
+    }
+
+    TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T18");
+}
+
+void staticSchedulerTest() {
+    Scheduler staticScheduler;
+    CountingCallable first, second, third;
+
+    TEST_ASSERT_TRUE_MESSAGE(staticScheduler.add(first), "T1");
+    TEST_ASSERT_TRUE_MESSAGE(staticScheduler.add(second), "T2");
+    TEST_ASSERT_TRUE_MESSAGE(staticScheduler.add(second), "T3");
+    TEST_ASSERT_FALSE_MESSAGE(staticScheduler.add(third), "T4");
+
+    staticScheduler.run();
+    TEST_ASSERT_EQUAL_MESSAGE(1, first.callCount, "T5");
+    TEST_ASSERT_EQUAL_MESSAGE(1, second.callCount, "T6");
+    TEST_ASSERT_EQUAL_MESSAGE(0, third.callCount, "T7");
+
+    staticScheduler.remove(first);
+    TEST_ASSERT_TRUE_MESSAGE(staticScheduler.add(third), "T8");
+
+    staticScheduler.run();
+    TEST_ASSERT_EQUAL_MESSAGE(1, first.callCount, "T9");
+    TEST_ASSERT_EQUAL_MESSAGE(2, second.callCount, "T10");
+    TEST_ASSERT_EQUAL_MESSAGE(1, third.callCount, "T11");
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(staticVectorTest);
+    RUN_TEST(staticVectorBulkInsertTest);
+    RUN_TEST(staticSchedulerTest);
+    UNITY_END();
+}
+
+#endif // STEROIDO_UNIT_TEST_ENABLED
@@ -212,9 +212,195 @@ void vectorTest() {
 }
 
 
+/**
+ * @brief Counts its constructions, moves and destructions to check the object lifetimes in the vector
+ *
+ */
+class trackedObject {
+    public:
+        static int16_t alive;
+        static uint16_t copies;
+        static uint16_t moves;
+
+        trackedObject(uint16_t id, uint16_t factor) : id(id * factor) {
+            alive++;
+        }
+
+        trackedObject(const trackedObject &that) : id(that.id) {
+            alive++;
+            copies++;
+        }
+
+        trackedObject(trackedObject &&that) : id(that.id) {
+            that.id = 0xFFFF;
+            alive++;
+            moves++;
+        }
+
+        trackedObject& operator=(const trackedObject &that) {
+            id = that.id;
+            copies++;
+            return *this;
+        }
+
+        trackedObject& operator=(trackedObject &&that) {
+            id = that.id;
+            that.id = 0xFFFF;
+            moves++;
+            return *this;
+        }
+
+        ~trackedObject() {
+            alive--;
+        }
+
+        uint16_t id;
+};
+
+int16_t trackedObject::alive = 0;
+uint16_t trackedObject::copies = 0;
+uint16_t trackedObject::moves = 0;
+
+void vectorEmplaceTest() {
+    {
+        vector<trackedObject> objects;
+
+        // Growing moves the elements, nothing gets copied
+        for (uint16_t i = 0; i < ELEMENT_ADD_COUNT; i++) {
+            trackedObject &added = objects.emplace_back(i, 2);
+            TEST_ASSERT_EQUAL_MESSAGE(2 * i, added.id, "T1");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(ELEMENT_ADD_COUNT, trackedObject::alive, "T2");
+        TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::copies, "T3");
+
+        // Adding an element of the vector itself while it grows
+        while (objects.size() < objects.capacity()) objects.emplace_back(0, 0);
+        objects.push_back(objects[1]);
+        TEST_ASSERT_EQUAL_MESSAGE(2, objects.back().id, "T4");
+        TEST_ASSERT_EQUAL_MESSAGE(1, trackedObject::copies, "T5");
+
+        // Emplace in front, in the middle and at the end
+        while (objects.size() > 3) objects.pop_back();
+        TEST_ASSERT_EQUAL_MESSAGE(3, trackedObject::alive, "T6");
+        objects.emplace(objects.begin(), 7, 1);
+        objects.emplace(objects.begin() + 2, 8, 1);
+        objects.emplace(objects.end(), 9, 1);
+        objects.insert(objects.begin(), trackedObject(10, 1));
+
+        const uint16_t expected[] = {10, 7, 0, 8, 2, 4, 9};
+        TEST_ASSERT_EQUAL_MESSAGE(7, objects.size(), "T7");
+        for (uint16_t i = 0; i < objects.size(); i++) {
+            TEST_ASSERT_EQUAL_MESSAGE(expected[i], objects[i].id, "T8");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(7, trackedObject::alive, "T9");
+
+        objects.shrink_to_fit();
+        #ifdef STEROIDO_POOL_ALLOCATOR_ENABLED
+            // Small vectors use a whole pool block
+            TEST_ASSERT_EQUAL_MESSAGE(SteroidoPool::blockSize() / sizeof(trackedObject), objects.capacity(), "T10");
+        #else
+            TEST_ASSERT_EQUAL_MESSAGE(7, objects.capacity(), "T10");
+        #endif
+        TEST_ASSERT_EQUAL_MESSAGE(2, objects[4].id, "T11");
+    }
+
+    // Everything got destroyed exactly once
+    TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T12");
+
+    // Trivially copyable elements and reuse after clear()
+    vector<uint32_t> values;
+    for (uint32_t i = 0; i < ELEMENT_ADD_COUNT; i++) values.push_back(i);
+    values.clear();
+    TEST_ASSERT_TRUE_MESSAGE(values.empty(), "T13");
+    for (uint32_t i = 0; i < ELEMENT_ADD_COUNT; i++) values.emplace_back(i);
+    TEST_ASSERT_EQUAL_MESSAGE(ELEMENT_ADD_COUNT - 1, values.back(), "T14");
+}
+
+
+void vectorRangeTest() {
+    {
+        vector<trackedObject> objects;
+        for (uint16_t i = 0; i < 10; i++) objects.emplace_back(i, 1);
+
+        // Erase a range in the middle, the rest moves up
+        objects.erase(objects.begin() + 2, objects.begin() + 5);
+        const uint16_t afterErase[] = {0, 1, 5, 6, 7, 8, 9};
+        TEST_ASSERT_EQUAL_MESSAGE(7, objects.size(), "T1");
+        for (uint16_t i = 0; i < objects.size(); i++) {
+            TEST_ASSERT_EQUAL_MESSAGE(afterErase[i], objects[i].id, "T2");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(7, trackedObject::alive, "T3");
+
+        // Insert fewer elements than follow the position, then more, the value is an element itself
+        objects.insert(objects.begin() + 1, 2, objects[6]);
+        objects.insert(objects.begin() + 7, 4, objects[0]);
+        const uint16_t afterInsert[] = {0, 9, 9, 1, 5, 6, 7, 0, 0, 0, 0, 8, 9};
+        TEST_ASSERT_EQUAL_MESSAGE(13, objects.size(), "T4");
+        for (uint16_t i = 0; i < objects.size(); i++) {
+            TEST_ASSERT_EQUAL_MESSAGE(afterInsert[i], objects[i].id, "T5");
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(13, trackedObject::alive, "T6");
+
+        // Insert an array at the end, resize and assign
+        const trackedObject extra[] = {trackedObject(20, 1), trackedObject(21, 1)};
+        objects.insert(objects.end(), extra, extra + 2);
+        TEST_ASSERT_EQUAL_MESSAGE(21, objects.back().id, "T7");
+        objects.resize(3, extra[0]);
+        TEST_ASSERT_EQUAL_MESSAGE(3 + 2, trackedObject::alive, "T8");
+        objects.resize(6, objects[1]);
+        TEST_ASSERT_EQUAL_MESSAGE(9, objects[5].id, "T9");
+        objects.assign(extra, extra + 2);
+        TEST_ASSERT_EQUAL_MESSAGE(2, objects.size(), "T10");
+        TEST_ASSERT_EQUAL_MESSAGE(20, objects[0].id, "T11");
+        objects.assign(4, extra[1]);
+        TEST_ASSERT_EQUAL_MESSAGE(4, objects.size(), "T12");
+        TEST_ASSERT_EQUAL_MESSAGE(21, objects[3].id, "T13");
+        TEST_ASSERT_EQUAL_MESSAGE(4 + 2, trackedObject::alive, "T14");
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, trackedObject::alive, "T15");
+
+    // Trivially copyable elements against a plain array
+    vector<uint32_t> values;
+    uint32_t model[ELEMENT_ADD_COUNT];
+    uint16_t modelSize = 0;
+    srand(7);
+    for (uint16_t round = 0; round < 1000; round++) {
+        uint16_t pos = rand() % (modelSize + 1);
+        uint16_t count = rand() % 8;
+        if (rand() % 2 && modelSize + count <= ELEMENT_ADD_COUNT) {
+            for (uint16_t i = modelSize; i > pos; i--) model[i - 1 + count] = model[i - 1];
+            for (uint16_t i = 0; i < count; i++) model[pos + i] = round;
+            modelSize += count;
+            values.insert(values.begin() + pos, count, round);
+        } else {
+            if (pos + count > modelSize) count = modelSize - pos;
+            for (uint16_t i = pos; i + count < modelSize; i++) model[i] = model[i + count];
+            modelSize -= count;
+            values.erase(values.begin() + pos, values.begin() + pos + count);
+        }
+
+        TEST_ASSERT_EQUAL_MESSAGE(modelSize, values.size(), "T16");
+        for (uint16_t i = 0; i < modelSize; i++) {
+            TEST_ASSERT_EQUAL_MESSAGE(model[i], values[i], "T17");
+        }
+    }
+
+    // Growing in place keeps the elements, also when adding one of them
+    values.assign(model, model + modelSize);
+    while (values.size() < values.capacity()) values.push_back(values.size());
+    values.push_back(values[0]);
+    TEST_ASSERT_EQUAL_MESSAGE(model[0], values.back(), "T18");
+    for (uint16_t i = 0; i < modelSize; i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(model[i], values[i], "T19");
+    }
+}
+
+
 void setup() {
     UNITY_BEGIN();
     RUN_TEST(vectorTest);
+    RUN_TEST(vectorEmplaceTest);
+    RUN_TEST(vectorRangeTest);
     UNITY_END();
 }
 
@@ -0,0 +1,48 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+    Helpers of the native benchmarks in tools/bench. Build one with
+
+        g++ -std=gnu++11 -O2 -DNATIVE -pthread -I src tools/bench/bench_<Name>.cpp -o bench && ./bench
+
+    Programs with a BASELINE switch only use what existed before the optimization they measure,
+    build them with -DBASELINE against a checkout of that older commit to get the numbers before.
+*/
+
+// Results are written here, so the compiler can not drop the measured code
+volatile uint32_t benchSink;
+
+/**
+ * @brief Keeps the compiler from moving memory accesses across this point
+ *
+ */
+inline void benchBarrier() {
+    asm volatile("" ::: "memory");
+}
+
+/**
+ * @brief Run f repeatedly, the fastest of 5 runs counts (the others were disturbed)
+ *
+ * @return double Nanoseconds per call of f
+ */
+template<class F>
+double benchNanoseconds(F f, long repetitions) {
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < repetitions; i++) {
+            f();
+            benchBarrier();
+        }
+        double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (!run || time < best) best = time;
+    }
+    return best / repetitions;
+}
+
+#endif // BENCH_H
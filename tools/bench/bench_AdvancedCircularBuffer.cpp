@@ -0,0 +1,88 @@
+/*
+    Removal from the middle of a full AdvancedCircularBuffer of 16 byte frames, like acknowledged
+    frames of a send window. Each round refills the buffer (8 frames) and then removes 8 random
+    frames. Build with -DBASELINE to only use deleteFromTail()/deleteElement(), which the older
+    commits have as well.
+*/
+
+#include "Bench.h"
+#include "Common/AdvancedCircularBuffer.h"
+
+#define ROUNDS 200000
+
+struct Frame {
+    uint32_t id;
+    uint8_t acked;
+    uint8_t data[11];
+
+    bool operator==(const Frame &other) const {
+        return id == other.id;
+    }
+};
+
+static uint32_t randomState = 1;
+static uint32_t nextRandom() {
+    randomState = randomState * 1103515245u + 12345u;
+    return randomState >> 16;
+}
+
+template<size_t N, class Remove>
+void run(const char *name, Remove remove) {
+    AdvancedCircularBuffer<Frame, N> buffer;
+    uint32_t id = 0;
+    randomState = 1;
+
+    double time = benchNanoseconds([&] {
+        while (!buffer.full()) {
+            Frame frame = {};
+            frame.id = id++;
+            buffer.push(frame);
+        }
+        remove(buffer);
+    }, ROUNDS);
+
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < buffer.size(); i++) sum += buffer.getReferenceFromTail(i).id;
+    benchSink = sum;
+    printf("  %-28s %7.1f ns/round\n", name, time);
+}
+
+template<size_t N>
+void runAll() {
+    typedef AdvancedCircularBuffer<Frame, N> Buffer;
+    printf("N=%zu\n", N);
+
+    run<N>("deleteFromTail x8", [](Buffer &buffer) {
+        for (int k = 0; k < 8; k++) buffer.deleteFromTail(nextRandom() % buffer.size());
+    });
+    run<N>("deleteElement x8", [](Buffer &buffer) {
+        for (int k = 0; k < 8; k++) {
+            Frame frame = buffer.getReferenceFromTail(nextRandom() % buffer.size());
+            buffer.deleteElement(frame);
+        }
+    });
+
+#ifdef BASELINE
+    run<N>("range of 8 (deleteFromTail)", [](Buffer &buffer) {
+        uint32_t index = nextRandom() % (buffer.size() - 8);
+        for (int k = 0; k < 8; k++) buffer.deleteFromTail(index);
+    });
+#else
+    run<N>("deleteRangeFromTail 8", [](Buffer &buffer) {
+        buffer.deleteRangeFromTail(nextRandom() % (buffer.size() - 8), 8);
+    });
+    run<N>("deleteFromTailUnordered x8", [](Buffer &buffer) {
+        for (int k = 0; k < 8; k++) buffer.deleteFromTailUnordered(nextRandom() % buffer.size());
+    });
+    run<N>("mark x8 + deleteIf", [](Buffer &buffer) {
+        for (int k = 0; k < 8; k++) buffer.getReferenceFromTail(nextRandom() % buffer.size()).acked = 1;
+        buffer.deleteIf([](const Frame &frame) { return frame.acked != 0; });
+    });
+#endif
+}
+
+int main() {
+    runAll<64>();
+    runAll<100>();
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*
+    Ring buffer index arithmetic: CircularBuffer push + pop and AdvancedCircularBuffer indexed
+    access, for a power of two size (masked free-running indices) and another size (compare
+    wrapped indices). Builds against older commits unchanged to compare.
+*/
+
+#include "Bench.h"
+#include "Common/CircularBuffer.h"
+#include "Common/AdvancedCircularBuffer.h"
+
+#define ROUNDS 200000
+
+// Fill the buffer a bit over half, then empty it, so the indices wrap around
+template<uint16_t N>
+double pushPop() {
+    static CircularBuffer<uint32_t, N> buffer;
+    uint32_t round = 0;
+    uint32_t sum = 0;
+    double time = benchNanoseconds([&] {
+        uint32_t value;
+        for (uint32_t i = 0; i < N / 2 + 3; i++) buffer.push(i + round);
+        while (buffer.pop(value)) sum += value;
+        round++;
+    }, ROUNDS);
+    benchSink = sum;
+    return time / (N / 2 + 3);
+}
+
+// Read every element from both ends of a wrapped buffer
+template<size_t N>
+double indexedAccess() {
+    static AdvancedCircularBuffer<uint32_t, N, uint16_t> buffer;
+    for (uint32_t i = 0; i < N + N / 3; i++) buffer.push(i);
+
+    uint32_t sum = 0;
+    double time = benchNanoseconds([&] {
+        for (uint16_t i = 0; i < N; i++) sum += buffer.getReferenceFromTail(i) + buffer.getReferenceFromHead(i);
+    }, ROUNDS / 2);
+    benchSink = sum;
+    return time / (2 * N);
+}
+
+int main() {
+    printf("CircularBuffer push + pop       N=64 %5.2f ns/element   N=60 %5.2f ns/element\n", pushPop<64>(), pushPop<60>());
+    printf("AdvancedCircularBuffer indexed  N=64 %5.2f ns/access    N=60 %5.2f ns/access\n", indexedAccess<64>(), indexedAccess<60>());
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+    Cycles per mapped value (x86 only, rdtsc) of mapC and the mappers of FastMap.h, over 1024 ADC
+    values with the ranges only known at runtime (StaticMap excepted). Compares against mapC in
+    the same build, so there is no baseline build.
+*/
+
+#include <x86intrin.h>
+#include "Bench.h"
+#include "Common/mapC.h"
+#include "Common/FastMap.h"
+
+#define VALUES 1024
+#define ROUNDS 2000
+
+static int32_t adc[VALUES];
+volatile float floatSink;
+volatile int32_t integerSink;
+
+// The fastest of 5 runs
+template<class F>
+double cycles(F map) {
+    uint64_t best = ~0ull;
+    for (int run = 0; run < 5; run++) {
+        uint64_t start = __rdtsc();
+        for (int round = 0; round < ROUNDS; round++) {
+            for (int i = 0; i < VALUES; i++) map(adc[i]);
+        }
+        uint64_t time = __rdtsc() - start;
+        if (time < best) best = time;
+    }
+    return (double)best / (ROUNDS * (double)VALUES);
+}
+
+int main() {
+    for (int i = 0; i < VALUES; i++) adc[i] = (i * 37) & 1023;
+
+    // Read through volatile, so the compiler can not fold the ranges
+    volatile float floatRange[4] = {0, 1023, 0, 5};
+    volatile int32_t integerRange[4] = {0, 1023, 0, 5000};
+    float inMin = floatRange[0], inMax = floatRange[1], outMin = floatRange[2], outMax = floatRange[3];
+    int32_t inMinI = integerRange[0], inMaxI = integerRange[1], outMinI = integerRange[2], outMaxI = integerRange[3];
+
+    LinearMap<float> linear(inMin, inMax, outMin, outMax);
+    FixedLinearMap<int32_t> fixed(inMinI, inMaxI, outMinI, outMaxI);
+    FixedLinearMap<int32_t, int32_t> fixed32(inMinI, inMaxI, outMinI, outMaxI);
+    const float curveIn[] = {0, 128, 256, 384, 512, 640, 768, 1023};
+    const float curveOut[] = {-40, -10, 5, 20, 30, 50, 80, 150};
+    PiecewiseLinearMap<float, 8> curve(curveIn, curveOut);
+
+    printf("%-32s %5.2f cycles/value\n", "mapC<float>", cycles([&](int32_t x) { floatSink = mapC<float>(x, inMin, inMax, outMin, outMax); }));
+    printf("%-32s %5.2f cycles/value\n", "LinearMap<float>", cycles([&](int32_t x) { floatSink = linear(x); }));
+    printf("%-32s %5.2f cycles/value\n", "StaticMap<float>", cycles([&](int32_t x) { floatSink = StaticMap<0, 1023, 0, 5>::map<float>(x); }));
+    printf("%-32s %5.2f cycles/value\n", "mapC<int32_t>", cycles([&](int32_t x) { integerSink = mapC<int32_t>(x, inMinI, inMaxI, outMinI, outMaxI); }));
+    printf("%-32s %5.2f cycles/value\n", "FixedLinearMap<int32_t>", cycles([&](int32_t x) { integerSink = fixed(x); }));
+    printf("%-32s %5.2f cycles/value\n", "FixedLinearMap<int32_t, int32_t>", cycles([&](int32_t x) { integerSink = fixed32(x); }));
+    printf("%-32s %5.2f cycles/value\n", "StaticMap<int32_t>", cycles([&](int32_t x) { integerSink = StaticMap<0, 1023, 0, 5000>::map<int32_t>(x); }));
+    printf("%-32s %5.2f cycles/value\n", "PiecewiseLinearMap<float, 8>", cycles([&](int32_t x) { floatSink = curve(x); }));
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+    Pool allocator against new/delete: average cost of an allocate/deallocate pair with 64 live
+    blocks freed interleaved, and the latency distribution of single allocations during a random
+    churn of mixed sizes, where the heap has to search its fragmented free lists and the pool
+    stays O(1). The latencies include the cost of reading the clock.
+*/
+
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "Bench.h"
+#include "Common/PoolAllocator.h"
+
+#define LIVE 64
+#define ROUNDS 200000
+#define CHURN 2000000
+
+static PoolAllocator<32, 256> pool;
+static PoolAllocator<32, 256, PoolMutexLock> mutexPool;
+
+struct Heap {
+    void* allocate(size_t size) { return ::operator new(size); }
+    void deallocate(void *block) { ::operator delete(block); }
+};
+
+template<class P>
+struct Pool {
+    P &pool;
+    void* allocate(size_t) { return pool.allocate(); }
+    void deallocate(void *block) { pool.deallocate(block); }
+};
+
+static uint32_t randomState = 1;
+static uint32_t nextRandom() {
+    randomState = randomState * 1103515245u + 12345u;
+    return randomState >> 16;
+}
+
+// Allocate LIVE blocks of 24 to 31 bytes, free the even ones, then the odd ones
+template<class A>
+double pairTime(A allocator) {
+    void *blocks[LIVE];
+    return benchNanoseconds([&] {
+        for (int i = 0; i < LIVE; i++) blocks[i] = allocator.allocate(24 + (i & 7));
+        for (int i = 0; i < LIVE; i += 2) allocator.deallocate(blocks[i]);
+        for (int i = 1; i < LIVE; i += 2) allocator.deallocate(blocks[i]);
+    }, ROUNDS) / LIVE;
+}
+
+// Replace a random one of LIVE blocks each step, returns the latencies of the allocations sorted
+template<class A>
+std::vector<float> allocationLatencies(A allocator) {
+    void *blocks[LIVE];
+    for (int i = 0; i < LIVE; i++) blocks[i] = allocator.allocate(24);
+
+    std::vector<float> latencies(CHURN);
+    randomState = 1;
+    for (long step = 0; step < CHURN; step++) {
+        uint32_t slot = nextRandom() % LIVE;
+        size_t size = 8 + nextRandom() % 24;
+        allocator.deallocate(blocks[slot]);
+
+        auto start = std::chrono::steady_clock::now();
+        blocks[slot] = allocator.allocate(size);
+        latencies[step] = std::chrono::duration<float, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    for (int i = 0; i < LIVE; i++) allocator.deallocate(blocks[i]);
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+template<class A>
+void printLatencies(const char *name, A allocator) {
+    std::vector<float> latencies = allocationLatencies(allocator);
+    printf("  %-12s median %5.0f ns  99.9%% %5.0f ns  99.99%% %5.0f ns\n", name,
+        latencies[CHURN / 2], latencies[CHURN - CHURN / 1000], latencies[CHURN - CHURN / 10000]);
+}
+
+int main() {
+    printf("allocate + deallocate, %d live blocks\n", LIVE);
+    printf("  new/delete   %6.1f ns\n", pairTime(Heap()));
+    printf("  pool         %6.1f ns\n", pairTime(Pool<decltype(pool)>{pool}));
+    printf("  pool + mutex %6.1f ns\n", pairTime(Pool<decltype(mutexPool)>{mutexPool}));
+
+    printf("single allocations of %d random replacements\n", CHURN);
+    printLatencies("new/delete", Heap());
+    printLatencies("pool", Pool<decltype(pool)>{pool});
+    printf("  pool peak %zu of %zu blocks\n", pool.peak(), pool.blockCount());
+    return 0;
+}
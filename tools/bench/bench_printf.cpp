@@ -0,0 +1,59 @@
+/*
+    Formatting throughput of the bundled printf (sprintf_) for integer and float conversions,
+    with the snprintf of the C library as a reference. Builds against older commits unchanged to
+    compare.
+*/
+
+#include <stdio.h>
+#include "Bench.h"
+#include "Libraries/printf/printf.h"
+
+// The C library snprintf as the reference
+#undef snprintf
+#undef sprintf
+#undef printf
+
+#define VALUES 1024
+#define CALLS 1000000
+
+void _putchar(char) {}
+
+static uint32_t integers[VALUES];
+static unsigned long long longIntegers[VALUES];
+static double doubles[VALUES];
+
+template<typename T>
+void run(const char *format, const T *values) {
+    char text[64];
+    long i = 0;
+    double bundled = benchNanoseconds([&] {
+        sprintf_(text, format, values[i++ & (VALUES - 1)]);
+        benchSink = text[0];
+    }, CALLS);
+    double library = benchNanoseconds([&] {
+        snprintf(text, sizeof(text), format, values[i++ & (VALUES - 1)]);
+        benchSink = text[0];
+    }, CALLS);
+    printf("%-8s sprintf_ %6.1f ns  C library %6.1f ns\n", format, bundled, library);
+}
+
+int main() {
+    uint32_t state = 12345;
+    for (int i = 0; i < VALUES; i++) {
+        state = state * 1103515245u + 12345u;
+        integers[i] = state;
+        longIntegers[i] = (unsigned long long)state * state * 7;
+        doubles[i] = (state % 2000000) / 1000.0 - 1000;
+    }
+
+    run("%u", integers);
+    run("%d", reinterpret_cast<const int*>(integers));
+    run("%x", integers);
+    run("%08X", integers);
+    run("%llu", longIntegers);
+    run("%f", doubles);
+    run("%.2f", doubles);
+    run("%.0f", doubles);
+    run("%e", doubles);
+    return 0;
+}
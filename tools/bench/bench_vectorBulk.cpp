@@ -0,0 +1,50 @@
+/*
+    Bulk edits of the bundled vector with uint32_t elements: push_back growth up to 100k elements,
+    and erasing / inserting 100 elements in the middle of 1000 (including filling the vector).
+    Build with -DBASELINE for the commits before the range erase/insert, then the edits are done
+    with single erase()/insert() calls.
+*/
+
+#include "Bench.h"
+#include "Common/vector.h"
+
+#define COUNT 1000
+#define EDITED 100
+#define POSITION 100
+
+int main() {
+    uint32_t source[EDITED];
+    for (uint32_t i = 0; i < EDITED; i++) source[i] = i;
+
+    double growth = benchNanoseconds([] {
+        std::vector<uint32_t> vector;
+        for (uint32_t i = 0; i < 100000; i++) vector.push_back(i);
+        benchSink = vector[777];
+    }, 200);
+    printf("%-36s %8.1f us\n", "push_back 100k elements", growth / 1000);
+
+    double erase = benchNanoseconds([] {
+        std::vector<uint32_t> vector(COUNT);
+        for (uint32_t i = 0; i < COUNT; i++) vector.push_back(i);
+#ifdef BASELINE
+        for (int i = 0; i < EDITED; i++) vector.erase(vector.begin() + POSITION);
+#else
+        vector.erase(vector.begin() + POSITION, vector.begin() + POSITION + EDITED);
+#endif
+        benchSink = vector[150];
+    }, 20000);
+    printf("%-36s %8.1f ns\n", "erase 100 of 1000 (with the fill)", erase);
+
+    double insert = benchNanoseconds([&source] {
+        std::vector<uint32_t> vector(COUNT + EDITED);
+        for (uint32_t i = 0; i < COUNT; i++) vector.push_back(i);
+#ifdef BASELINE
+        for (int i = 0; i < EDITED; i++) vector.insert(vector.begin() + POSITION + i, source[i]);
+#else
+        vector.insert(vector.begin() + POSITION, source, source + EDITED);
+#endif
+        benchSink = vector[150];
+    }, 20000);
+    printf("%-36s %8.1f ns\n", "insert 100 into 1000 (with the fill)", insert);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+    push_back of 1000 elements into an empty bundled vector, for a trivially copyable type, a type
+    with a user defined copy, and a type owning heap memory, which a move-aware vector moves on
+    growth instead of copying. Build with -DBASELINE for the commits before the move-aware vector:
+    that vector assigned over destroyed elements, so the string type there has no move constructor
+    and no destructor (it leaks).
+*/
+
+#include <string.h>
+#include "Bench.h"
+#include "Common/vector.h"
+
+#define ROUNDS 2000
+#define COUNT 1000
+
+struct Message {
+    uint8_t data[48];
+
+    Message() { memset(data, 1, sizeof(data)); }
+    Message(const Message &other) { memcpy(data, other.data, sizeof(data)); }
+    Message &operator=(const Message &other) { memcpy(data, other.data, sizeof(data)); return *this; }
+    ~Message() {}
+};
+
+struct String {
+    char *text;
+    uint16_t length;
+
+    String() : text(new char[32]), length(32) { text[0] = 1; }
+    String(const String &other) : text(new char[other.length]), length(other.length) { memcpy(text, other.text, length); }
+
+    String &operator=(const String &other) {
+        // No delete of the old text: the baseline vector assigns to destroyed elements
+        char *copy = new char[other.length];
+        memcpy(copy, other.text, other.length);
+        text = copy;
+        length = other.length;
+        return *this;
+    }
+
+#ifndef BASELINE
+    String(String &&other) : text(other.text), length(other.length) { other.text = nullptr; }
+    ~String() { delete[] text; }
+#endif
+};
+
+template<class T>
+void run(const char *name) {
+    double time = benchNanoseconds([] {
+        std::vector<T> vector;
+        T value = T();
+        for (int i = 0; i < COUNT; i++) vector.push_back(value);
+        benchSink = vector.size();
+    }, ROUNDS);
+    printf("  %-24s %6.2f ns/push_back\n", name, time / COUNT);
+}
+
+int main() {
+    printf("%d push_back from empty\n", COUNT);
+    run<uint32_t>("uint32_t");
+    run<Message>("48 byte user copy");
+    run<String>("heap owning string");
+    return 0;
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Decode the binary output of the Steroido DeferredLogger into text.
+
+Usage:
+    decode_deferred_log.py log.bin             # decode a recorded file
+    decode_deferred_log.py /dev/ttyACM0 115200 # decode a serial port live (needs pyserial)
+    ... | decode_deferred_log.py -             # decode stdin
+
+The record format is described in src/Communication/DeferredLogger.h.
+"""
+
+import binascii
+import re
+import struct
+import sys
+
+from decode_telemetry import cobs_decode
+
+FORMAT_RECORD = ord('F')
+MESSAGE_RECORD = ord('M')
+DROPPED_RECORD = ord('D')
+
+# printf conversion: flags, width, precision, length modifier, conversion
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diuoxXfFeEgGcspb%])')
+
+
+def read_arguments(payload):
+    """Parse the typed arguments of a message record."""
+    arguments = []
+    position = 0
+    while position < len(payload):
+        code = chr(payload[position])
+        position += 1
+        if code == 's':
+            length = payload[position]
+            arguments.append(payload[position + 1:position + 1 + length].decode('utf-8', 'replace'))
+            position += 1 + length
+        elif code == 'c':
+            arguments.append(chr(payload[position]))
+            position += 1
+        else:
+            size = struct.calcsize('<' + code)
+            arguments.append(struct.unpack_from('<' + code, payload, position)[0])
+            position += size
+    return arguments
+
+
+def format_message(format_string, arguments):
+    """Format like printf on the target, with the raw arguments."""
+    arguments = list(arguments)
+
+    def take():
+        return arguments.pop(0) if arguments else 0
+
+    def replace(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if width == '*':
+            width = str(take())
+        if precision == '*':
+            precision = str(take())
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+        value = take()
+        if conversion in 'cs':
+            return (spec + 's') % (value,)
+        if conversion in 'fFeEgG':
+            return (spec + conversion) % (float(value),)
+        if isinstance(value, str):
+            value = ord(value)
+        if conversion == 'p':
+            return (spec + 's') % ('0x%x' % value,)
+        if conversion == 'b':
+            return (spec + 's') % (format(value, 'b'),)
+        return (spec + conversion.replace('u', 'd').replace('i', 'd')) % (value,)
+
+    return CONVERSION.sub(replace, format_string)
+
+
+class Decoder:
+    """Turns a stream of bytes into lines of text, keeps the received format strings."""
+
+    def __init__(self):
+        self.formats = {}
+        self.buffer = bytearray()
+        self.invalid_records = 0
+
+    def feed(self, data):
+        """Add received bytes, returns the decoded lines."""
+        self.buffer += data
+        lines = []
+        while True:
+            end = self.buffer.find(b'\x00')
+            if end < 0:
+                break
+            encoded = bytes(self.buffer[:end])
+            del self.buffer[:end + 1]
+            if encoded:
+                lines.extend(self.frame(encoded))
+        return lines
+
+    def frame(self, encoded):
+        record = cobs_decode(encoded)
+        if record is None or len(record) < 3:
+            self.invalid_records += 1
+            return []
+        payload, (crc,) = record[:-2], struct.unpack('<H', record[-2:])
+        if binascii.crc_hqx(payload, 0xFFFF) != crc:
+            self.invalid_records += 1
+            return []
+
+        try:
+            return self.record(payload[0], payload[1:])
+        except (struct.error, IndexError, TypeError, ValueError):
+            # A valid CRC but not parseable, e.g. a newer record layout
+            self.invalid_records += 1
+            return []
+
+    def record(self, record_type, payload):
+        if record_type == FORMAT_RECORD:
+            (format_id,) = struct.unpack_from('<I', payload)
+            self.formats[format_id] = payload[4:].decode('utf-8', 'replace')
+            return []
+        if record_type == MESSAGE_RECORD:
+            (format_id,) = struct.unpack_from('<I', payload)
+            arguments = read_arguments(payload[4:])
+            if format_id not in self.formats:
+                return ['<unknown format 0x%08x> %r' % (format_id, arguments)]
+            return format_message(self.formats[format_id], arguments).splitlines()
+        if record_type == DROPPED_RECORD:
+            (count,) = struct.unpack_from('<I', payload)
+            return ['<%d messages dropped>' % count]
+        return ['<unknown record 0x%02x>' % record_type]
+
+
+def main(arguments):
+    if len(arguments) < 2:
+        print(__doc__)
+        return 1
+
+    decoder = Decoder()
+    if arguments[1] == '-':
+        source = sys.stdin.buffer
+    elif len(arguments) > 2:
+        import serial
+        source = serial.Serial(arguments[1], int(arguments[2]))
+    else:
+        source = open(arguments[1], 'rb')
+
+    invalid_records = 0
+    while True:
+        data = source.read(1) if len(arguments) > 2 else source.read(4096)
+        if not data:
+            break
+        for line in decoder.feed(data):
+            print(line, flush=True)
+
+        if decoder.invalid_records != invalid_records:
+            invalid_records = decoder.invalid_records
+            print('<%d records invalid>' % invalid_records, file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
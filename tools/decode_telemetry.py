@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Decode the binary stream of the Steroido Telemetry into text or CSV.
+
+Usage:
+    decode_telemetry.py telemetry.bin             # decode a recorded file
+    decode_telemetry.py /dev/ttyACM0 115200       # decode a serial port live (needs pyserial)
+    ... | decode_telemetry.py -                   # decode stdin
+    decode_telemetry.py --csv telemetry.bin       # one "timestamp,channel,value" line per sample
+
+The frame format is described in src/Communication/Telemetry.h.
+"""
+
+import binascii
+import struct
+import sys
+
+SAMPLES_FRAME = ord('S')
+CHANNEL_FRAME = ord('C')
+TIMESTAMP_CHANNEL = 0xFF
+
+
+def cobs_decode(encoded):
+    """Decode a COBS frame (without the separating zero), None if it is invalid."""
+    data = bytearray()
+    position = 0
+    while position < len(encoded):
+        code = encoded[position]
+        if code == 0 or position + code > len(encoded):
+            return None
+        data += encoded[position + 1:position + code]
+        position += code
+        if code != 0xFF and position < len(encoded):
+            data.append(0)
+    return bytes(data)
+
+
+class Decoder:
+    """Turns a stream of bytes into samples, keeps the received channels."""
+
+    def __init__(self):
+        self.channels = {}
+        self.buffer = bytearray()
+        self.timestamp = None
+        self.sequence = None
+        self.lost_frames = 0
+        self.invalid_frames = 0
+
+    def feed(self, data):
+        """Add received bytes, returns the decoded (timestamp, channel name, value) samples."""
+        self.buffer += data
+        samples = []
+        while True:
+            end = self.buffer.find(b'\x00')
+            if end < 0:
+                break
+            encoded = bytes(self.buffer[:end])
+            del self.buffer[:end + 1]
+            if encoded:
+                samples.extend(self.frame(encoded))
+        return samples
+
+    def frame(self, encoded):
+        frame = cobs_decode(encoded)
+        if frame is None or len(frame) < 3:
+            self.invalid_frames += 1
+            return []
+        payload, (crc,) = frame[:-2], struct.unpack('<H', frame[-2:])
+        if binascii.crc_hqx(payload, 0xFFFF) != crc:
+            self.invalid_frames += 1
+            return []
+
+        if payload[0] == CHANNEL_FRAME and len(payload) >= 3:
+            self.channels[payload[1]] = (payload[3:].decode('utf-8', 'replace'), '<' + chr(payload[2]))
+            return []
+        if payload[0] == SAMPLES_FRAME and len(payload) >= 2:
+            return self.samples(payload[1], payload[2:])
+        self.invalid_frames += 1
+        return []
+
+    def samples(self, sequence, records):
+        if self.sequence is not None:
+            self.lost_frames += (sequence - self.sequence - 1) & 0xFF
+        self.sequence = sequence
+
+        samples = []
+        position = 0
+        while position < len(records):
+            channel = records[position]
+            position += 1
+            if channel == TIMESTAMP_CHANNEL:
+                (self.timestamp,) = struct.unpack_from('<I', records, position)
+                position += 4
+            elif channel in self.channels:
+                name, code = self.channels[channel]
+                (value,) = struct.unpack_from(code, records, position)
+                position += struct.calcsize(code)
+                if code == '<f':
+                    # A float has about 7 significant digits, hide the noise of the conversion to double
+                    value = float('%.7g' % value)
+                samples.append((self.timestamp, name, value))
+            else:
+                # The size of the rest is unknown without the channel type
+                samples.append((self.timestamp, '<unknown channel %d>' % channel, records[position:].hex()))
+                break
+        return samples
+
+
+def main(arguments):
+    csv = '--csv' in arguments
+    arguments = [argument for argument in arguments if argument != '--csv']
+    if len(arguments) < 2:
+        print(__doc__)
+        return 1
+
+    decoder = Decoder()
+    if arguments[1] == '-':
+        source = sys.stdin.buffer
+    elif len(arguments) > 2:
+        import serial
+        source = serial.Serial(arguments[1], int(arguments[2]))
+    else:
+        source = open(arguments[1], 'rb')
+
+    lost_frames = invalid_frames = 0
+    while True:
+        data = source.read(1) if len(arguments) > 2 else source.read(4096)
+        if not data:
+            break
+        for timestamp, name, value in decoder.feed(data):
+            time = '' if timestamp is None else timestamp
+            print(('%s,%s,%s' if csv else '%s\t%s\t%s') % (time, name, value), flush=True)
+
+        if decoder.lost_frames != lost_frames or decoder.invalid_frames != invalid_frames:
+            lost_frames, invalid_frames = decoder.lost_frames, decoder.invalid_frames
+            print('<%d frames lost, %d invalid>' % (lost_frames, invalid_frames), file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))